@@ -0,0 +1,64 @@
+#ifndef CDCLSOLVE_BATCH
+#define CDCLSOLVE_BATCH
+
+#include "Formula.hpp"
+#include "Solver.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cdclsolve {
+
+class Batch {
+public:
+  Batch(const std::string &listOrDirectory, std::size_t numberOfJobs,
+        const Solver::Budget &budget, const std::string &decisionHeuristic,
+        const std::string &restartStrategy, bool isPreprocessing);
+  void solve(std::ostream &to, const std::string &recordFormat,
+             const std::string &outputDirectory,
+             const std::string &solutionFormat);
+  void interrupt();
+
+private:
+  enum class Format { JSON, CSV };
+  struct Record {
+    std::string fileName{};
+    std::string result{};
+    double durationRead{0.0};
+    double durationSolve{0.0};
+    std::uint64_t conflicts{0};
+    std::string error{};
+  };
+  static const std::map<std::string, Format> formatMap;
+  static const std::map<Solver::Result, std::string> resultMap;
+  static constexpr std::string_view CSV_HEADER{
+      "file,result,read,solve,conflicts,error"};
+  static constexpr std::string_view SOLUTION_EXTENSION{".sol"};
+  static constexpr std::string_view INTERRUPTED{"interrupted"};
+  std::vector<std::string> fileNames;
+  const std::size_t numberOfJobs;
+  const Solver::Budget budget;
+  const std::string decisionHeuristic;
+  const std::string restartStrategy;
+  const bool isPreprocessing;
+  std::vector<Solver *> jobs;
+  std::mutex mutex;
+  bool isInterrupted{false};
+  Record solveFile(std::size_t job, const std::string &fileName,
+                   const std::string &outputDirectory,
+                   const std::string &solutionFormat);
+  static std::string formatRecord(const Record &record, Format format);
+  static std::string quoteJson(const std::string &text);
+  static std::string quoteCsv(const std::string &text);
+};
+
+} // namespace cdclsolve
+
+#endif
@@ -1,46 +1,53 @@
 #ifndef CDCLSOLVE_CLAUSE
 #define CDCLSOLVE_CLAUSE
 
-#include "Variable.hpp"
-
+#include <cstddef>
 #include <cstdint>
-#include <memory>
-#include <set>
-#include <utility>
 #include <vector>
 
 namespace cdclsolve {
 
+class VariableStore;
+
 class Clause {
 public:
-  explicit Clause(
-      std::vector<std::pair<std::shared_ptr<Variable>, bool>> variables);
-  void printWatches() const;
-  std::size_t size() const;
+  enum class Tier { CORE, TIER2, LOCAL };
+  static constexpr std::size_t HEADER_SIZE{3};
+  static constexpr std::int32_t FLAG_LEARNED{1};
+  static constexpr std::int32_t FLAG_DELETED{2};
+  static constexpr std::int32_t FLAG_USED{4};
+  static constexpr std::int32_t FLAG_RELOCATED{8};
+  static constexpr std::int32_t FLAG_IMPORTED{64};
+  explicit Clause(std::int32_t *header) : header{header} {}
+  std::size_t size() const { return static_cast<std::size_t>(header[0]); }
+  std::int32_t &operator[](std::size_t i) { return header[HEADER_SIZE + i]; }
+  std::int32_t operator[](std::size_t i) const {
+    return header[HEADER_SIZE + i];
+  }
+  std::int32_t *begin() { return header + HEADER_SIZE; }
+  std::int32_t *end() { return header + HEADER_SIZE + size(); }
+  const std::int32_t *begin() const { return header + HEADER_SIZE; }
+  const std::int32_t *end() const { return header + HEADER_SIZE + size(); }
+  bool hasFlag(std::int32_t flag) const { return (header[1] & flag) != 0; }
+  void setFlag(std::int32_t flag, bool isSet);
+  Tier getTier() const;
+  void setTier(Tier tier);
+  std::int32_t getLbd() const;
+  void setLbd(std::int32_t lbd);
+  float getActivity() const;
+  void setActivity(float activity);
+  std::uint32_t getRelocation() const;
+  void setRelocation(std::uint32_t reference);
   bool hasLiteral(std::int32_t literal) const;
-  void setSatisfied(std::int32_t variable) const;
-  void setUnsatisfied(std::int32_t variable) const;
-  bool isSatisfied() const;
-  bool isUnsatisfied() const;
-  bool isUnit() const;
-  bool isUndecided() const;
-  bool isSatisfying(std::int32_t literal) const;
-  std::int32_t getSatisfyingAssignment() const;
-  std::set<std::int32_t> getLiterals() const;
-  std::vector<std::int32_t> getLiteralsAsVector() const;
-  bool resolve(std::shared_ptr<const Clause> clause);
+  bool isSatisfied(const VariableStore &variables) const;
+  bool isUnsatisfied(const VariableStore &variables) const;
 
 private:
-  std::vector<std::pair<std::shared_ptr<Variable>, bool>> variables;
-  mutable std::int32_t watch0;
-  mutable std::int32_t watch1;
-  bool
-  isSatisfied(const std::pair<std::shared_ptr<Variable>, bool> &variable) const;
-  bool isUnsatisfied(
-      const std::pair<std::shared_ptr<Variable>, bool> &variable) const;
-  bool isUnassigned(
-      const std::pair<std::shared_ptr<Variable>, bool> &variable) const;
-  void updateWatches() const;
+  static constexpr std::int32_t FLAG_BITS{8};
+  static constexpr std::int32_t FLAG_MASK{(1 << FLAG_BITS) - 1};
+  static constexpr std::int32_t TIER_SHIFT{4};
+  static constexpr std::int32_t TIER_MASK{3 << TIER_SHIFT};
+  std::int32_t *header;
 };
 
 } // namespace cdclsolve
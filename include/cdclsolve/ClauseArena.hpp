@@ -0,0 +1,47 @@
+#ifndef CDCLSOLVE_CLAUSEARENA
+#define CDCLSOLVE_CLAUSEARENA
+
+#include "Clause.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace cdclsolve {
+
+using ClauseReference = std::uint32_t;
+
+class ClauseArena {
+public:
+  static constexpr ClauseReference NO_CLAUSE{
+      std::numeric_limits<ClauseReference>::max()};
+  ClauseArena();
+  ClauseArena(const ClauseArena &other);
+  ClauseArena(ClauseArena &&other) noexcept;
+  ~ClauseArena();
+  ClauseArena &operator=(const ClauseArena &other);
+  ClauseArena &operator=(ClauseArena &&other) noexcept;
+  ClauseReference add(const std::vector<std::int32_t> &literals,
+                      bool isLearned);
+  void remove(ClauseReference reference);
+  ClauseReference relocate(ClauseReference reference, ClauseArena &to);
+  void reserve(std::size_t size);
+  Clause operator[](ClauseReference reference) {
+    return Clause{memory.data() + reference};
+  }
+  const Clause operator[](ClauseReference reference) const {
+    return Clause{const_cast<std::int32_t *>(memory.data()) + reference};
+  }
+  std::size_t getMemorySize() const;
+  std::size_t getWastedSize() const;
+
+private:
+  static thread_local std::vector<std::int32_t> spareMemory;
+  std::vector<std::int32_t> memory;
+  std::size_t wasted{0};
+};
+
+} // namespace cdclsolve
+
+#endif
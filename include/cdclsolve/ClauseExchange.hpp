@@ -0,0 +1,53 @@
+#ifndef CDCLSOLVE_CLAUSEEXCHANGE
+#define CDCLSOLVE_CLAUSEEXCHANGE
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cdclsolve {
+
+class ClauseExchange {
+public:
+  static constexpr std::size_t MAX_CLAUSE_SIZE{32};
+  ClauseExchange(std::size_t numberOfThreads, std::size_t maxSize,
+                 std::int32_t maxLbd);
+  bool exportClause(std::size_t thread, const std::int32_t *begin,
+                    const std::int32_t *end, std::int32_t lbd);
+  bool importClause(std::size_t thread, std::vector<std::int32_t> &literals,
+                    std::int32_t &lbd);
+
+private:
+  static constexpr std::size_t CAPACITY{1 << 12};
+  static constexpr std::size_t FILTER_SIZE{1 << 16};
+  static constexpr std::size_t CACHE_LINE_SIZE{64};
+  struct Slot {
+    std::atomic<std::uint64_t> sequence{0};
+    std::atomic<std::int32_t> size{0};
+    std::atomic<std::int32_t> lbd{0};
+    std::array<std::atomic<std::int32_t>, MAX_CLAUSE_SIZE> literals;
+  };
+  struct alignas(CACHE_LINE_SIZE) Channel {
+    std::vector<Slot> slots{CAPACITY};
+    std::atomic<std::uint64_t> head{0};
+  };
+  struct alignas(CACHE_LINE_SIZE) Importer {
+    std::vector<std::uint64_t> cursors;
+    std::vector<std::uint64_t> filter;
+    std::size_t channel{0};
+  };
+  const std::size_t maxSize;
+  const std::int32_t maxLbd;
+  std::vector<Channel> channels;
+  std::vector<Importer> importers;
+  static std::uint64_t hash(const std::int32_t *begin, const std::int32_t *end);
+  static bool isDuplicate(Importer &importer, std::uint64_t clauseHash);
+  bool readSlot(const Slot &slot, std::uint64_t position,
+                std::vector<std::int32_t> &literals, std::int32_t &lbd) const;
+};
+
+} // namespace cdclsolve
+
+#endif
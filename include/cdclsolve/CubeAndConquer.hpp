@@ -0,0 +1,72 @@
+#ifndef CDCLSOLVE_CUBEANDCONQUER
+#define CDCLSOLVE_CUBEANDCONQUER
+
+#include "Formula.hpp"
+#include "Solver.hpp"
+#include "WorkStealingDeque.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cdclsolve {
+
+class CubeAndConquer {
+public:
+  using Reporter = std::function<void(std::size_t thread, const Solver &solver,
+                                      Solver::Report report)>;
+  struct Cube {
+    std::vector<std::int32_t> literals;
+    Solver::Result result{Solver::Result::UNKNOWN};
+    std::chrono::steady_clock::duration duration{
+        std::chrono::steady_clock::duration::zero()};
+    std::size_t worker{0};
+  };
+  CubeAndConquer(Formula formula, std::size_t numberOfWorkers,
+                 std::size_t cubeDepth, const std::string &decisionHeuristic,
+                 const std::string &restartStrategy);
+  Solver::Result solve();
+  void interrupt();
+  void setBudget(const Solver::Budget &budget);
+  void enableStatistics();
+  void setReporter(const Reporter &reporter, std::uint64_t conflictInterval);
+  void requestReport(Solver::Report report);
+  const Formula &getFormula() const;
+  const Solver &getSolver() const;
+  const std::vector<Cube> &getCubes() const;
+  std::chrono::steady_clock::duration getDurationLookahead() const;
+
+private:
+  const std::size_t cubeDepth;
+  std::vector<Formula> formulas;
+  std::vector<std::unique_ptr<Solver>> solvers;
+  std::vector<WorkStealingDeque> deques;
+  std::vector<Cube> cubes;
+  std::vector<std::int32_t> cube;
+  std::chrono::steady_clock::duration durationLookahead{
+      std::chrono::steady_clock::duration::zero()};
+  std::atomic<std::size_t> winner;
+  std::atomic<bool> isInterrupted{false};
+  std::size_t winningCube{0};
+  Solver::Budget budget;
+  std::chrono::steady_clock::time_point budgetDeadline;
+  std::atomic<std::uint64_t> budgetConflicts{0};
+  std::atomic<std::uint64_t> budgetPropagations{0};
+  void generateCubes(Formula &formula);
+  void work(std::size_t worker);
+  Solver::Result solveCube(std::size_t worker,
+                           const std::vector<std::int32_t> &literals);
+  bool isBudgetExhausted() const;
+  std::uint64_t reserveBudget(std::atomic<std::uint64_t> &remaining) const;
+  bool takeCube(std::size_t worker, std::size_t &index);
+  std::size_t getWinner() const;
+};
+
+} // namespace cdclsolve
+
+#endif
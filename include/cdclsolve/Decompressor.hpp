@@ -0,0 +1,48 @@
+#ifndef CDCLSOLVE_DECOMPRESSOR
+#define CDCLSOLVE_DECOMPRESSOR
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cdclsolve {
+
+class Decompressor {
+public:
+  enum class Format { NONE, GZIP, XZ, BZIP2 };
+  static Format detectFormat(const char *begin, const char *end);
+  Decompressor(const char *begin, const char *end, Format format);
+  Decompressor(const Decompressor &) = delete;
+  Decompressor &operator=(const Decompressor &) = delete;
+  ~Decompressor();
+  std::size_t read(char *data, std::size_t size);
+
+private:
+  static constexpr std::size_t BLOCK_SIZE{1 << 20};
+  static constexpr std::size_t MAX_BLOCKS{8};
+  const char *const begin;
+  const char *const end;
+  std::mutex mutex;
+  std::condition_variable blockAdded;
+  std::condition_variable blockRemoved;
+  std::deque<std::vector<char>> blocks;
+  std::vector<char> block;
+  std::size_t blockPosition{0};
+  bool isFinished{false};
+  bool isStopped{false};
+  std::exception_ptr error;
+  std::thread worker;
+  void run(Format format);
+  void inflateGzip();
+  void decompressXz();
+  void decompressBzip2();
+  bool push(std::vector<char> &output, std::size_t size);
+};
+
+} // namespace cdclsolve
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef CDCLSOLVE_DIMACSPARSER
+#define CDCLSOLVE_DIMACSPARSER
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace cdclsolve {
+
+class DimacsParser {
+public:
+  const char *parseHeader(const char *begin, const char *end);
+  void parseClauses(const char *begin, const char *end);
+  bool hasHeader() const;
+  std::int32_t getNumberOfAtoms() const;
+  std::int32_t getNumberOfClauses() const;
+  std::size_t getSize() const;
+  std::vector<std::int32_t> takeLiterals();
+
+private:
+  static constexpr char COMMENT_LINE_C{'c'};
+  static constexpr std::string_view PROBLEM_LINE_P{"p"};
+  static constexpr std::string_view PROBLEM_LINE_CNF{"cnf"};
+  bool isHeaderParsed{false};
+  std::int32_t numberOfAtoms{0};
+  std::int32_t numberOfClauses{0};
+  std::vector<std::int32_t> literals;
+  static bool isBlank(char c);
+  static const char *skipBlanks(const char *begin, const char *end);
+  static const char *skipLine(const char *begin, const char *end);
+  static const char *findTokenEnd(const char *begin, const char *end);
+  static std::int32_t parseCount(const char *&begin, const char *end);
+};
+
+} // namespace cdclsolve
+
+#endif
@@ -2,21 +2,41 @@
 #define CDCLSOLVE_FORMULA
 
 #include "Clause.hpp"
-#include "Variable.hpp"
+#include "ClauseArena.hpp"
+#include "ClauseExchange.hpp"
+#include "DimacsParser.hpp"
+#include "ProofWriter.hpp"
+#include "ScoreHeap.hpp"
+#include "VariableStore.hpp"
+#include "VsidsQueue.hpp"
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <istream>
 #include <memory>
 #include <ostream>
+#include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace cdclsolve {
 
 class Formula {
 public:
+  Formula();
   static Formula readInput(std::istream &from);
-  static void writeOutput(const Formula &formula, std::ostream &to);
+  static Formula readInput(const std::string &fileName);
+  static void writeBinary(const Formula &formula, std::ostream &to);
+  const VariableStore &getVariables() const;
+  std::int32_t getNumberOfClauses() const;
+  void addClause(std::vector<std::int32_t> literals);
+  void addVariables(std::int32_t numberOfAtoms);
+  void preprocess();
+  void reconstructModel();
+  bool isEliminated(std::int32_t variable) const;
+  std::vector<std::int32_t> analyzeAssumption(std::int32_t literal);
   bool hasFreeLiterals() const;
   void propagateUnitLiterals(std::int32_t decisionLevel);
   void assign(std::int32_t literal, std::int32_t decisionLevel);
@@ -24,39 +44,113 @@ public:
   std::int32_t decideJeroslowWang() const;
   std::int32_t decideDlis() const;
   std::int32_t decideVsids() const;
+  std::int32_t decideLookahead();
+  void addDecisionLevel();
+  void cancel(std::int32_t decisionLevel);
   bool hasConflict() const;
   std::int32_t resolveConflict(std::int32_t decisionLevel);
+  void setProofWriter(ProofWriter &writer);
+  bool hasProofWriter() const;
+  void diversify(std::uint32_t seed, bool isPositivePhase);
+  std::int32_t getLearnedClauseLbd() const;
+  std::size_t getLearnedClauseSize() const;
+  void restart();
+  void setClauseExchange(ClauseExchange &exchange, std::size_t thread);
+  bool importClauses();
+  std::uint64_t getConflicts() const;
+  std::uint64_t getPropagations() const;
+  std::uint64_t getReductions() const;
+  bool isReductionDue() const;
+  std::size_t getTrailSize() const;
+  std::size_t getNumberOfLearnedClauses() const;
+  std::uint64_t getExportedClauses() const;
+  std::uint64_t getImportedClauses() const;
+  std::uint64_t getUsefulClauses() const;
+  std::size_t getEliminatedVariables() const;
 
 private:
-  static constexpr std::string_view COMMENT_LINE_C{"c"};
-  static constexpr std::string_view PROBLEM_LINE_P{"p"};
-  static constexpr std::string_view PROBLEM_LINE_CNF{"cnf"};
-  static constexpr std::string_view SOLUTION_LINE_S{"s"};
-  static constexpr std::string_view SOLUTION_LINE_CNF{"cnf"};
-  static constexpr std::string_view CERT_LINE_V{"V"};
-  const std::int32_t numberOfClauses;
-  std::vector<std::shared_ptr<Variable>> variables;
-  std::vector<std::shared_ptr<Clause>> clauses;
-  std::shared_ptr<Variable> conflict;
-  mutable std::vector<std::int32_t> vsidsScoresPositive;
-  mutable std::vector<std::int32_t> vsidsScoresNegative;
+  static constexpr std::string_view BINARY_MAGIC{"CDCLCNF", 8};
+  static constexpr std::uint32_t BINARY_VERSION{1};
+  static constexpr std::size_t INPUT_BUFFER_SIZE{1 << 20};
+  static constexpr std::size_t MIN_CHUNK_SIZE{1 << 24};
+  static constexpr std::int32_t CORE_LBD{2};
+  static constexpr std::int32_t TIER2_LBD{6};
+  static constexpr std::uint64_t REDUCE_INTERVAL{2000};
+  static constexpr std::uint64_t REDUCE_INCREMENT{300};
+  static constexpr float CLAUSE_ACTIVITY_DECAY{0.999f};
+  static constexpr float CLAUSE_ACTIVITY_RESCALE_LIMIT{1e20f};
+  static constexpr double DIVERSIFY_ACTIVITY{1e-3};
+  static constexpr std::size_t LOOKAHEAD_CANDIDATES{16};
+  std::int32_t numberOfClauses;
+  VariableStore variables;
+  ClauseArena clauseArena;
+  std::vector<ClauseReference> clauses;
+  std::vector<ClauseReference> learnedClauses;
+  std::vector<std::vector<ClauseReference>> watches;
+  std::vector<std::vector<ClauseReference>> occurrences;
+  std::vector<std::int32_t> trail;
+  std::vector<std::size_t> trailLimits;
+  std::vector<std::int8_t> seen;
+  std::vector<std::int32_t> learnedClause;
+  std::vector<std::int32_t> analyzeStack;
+  std::vector<std::int32_t> analyzeToClear;
+  std::vector<std::uint32_t> levelStamps;
+  std::uint32_t levelStamp{0};
+  std::int32_t learnedClauseLbd{0};
+  ProofWriter *proofWriter{nullptr};
+  std::unordered_map<ClauseReference, std::uint64_t> clauseIds;
+  std::vector<std::uint64_t> proofHints;
+  std::uint64_t nextClauseId{1};
+  ClauseExchange *clauseExchange{nullptr};
+  std::size_t exchangeThread{0};
+  std::vector<std::int32_t> importedClause;
+  std::uint64_t exportedClauses{0};
+  std::uint64_t importedClauses{0};
+  std::uint64_t usefulClauses{0};
+  bool isPreprocessed{false};
+  std::size_t eliminatedVariables{0};
+  std::vector<std::int8_t> eliminated;
+  std::vector<std::int32_t> reconstructionStack;
+  float clauseActivityIncrement{1.0f};
+  std::uint64_t conflicts{0};
+  std::uint64_t propagations{0};
+  std::uint64_t reductions{0};
+  std::uint64_t nextReduction{REDUCE_INTERVAL};
+  std::size_t propagationHead{0};
+  ClauseReference conflict{ClauseArena::NO_CLAUSE};
+  mutable VsidsQueue vsidsQueue;
+  mutable ScoreHeap jeroslowWangQueue;
+  mutable ScoreHeap dlisQueue;
+  mutable bool isJeroslowWangQueueActive{false};
+  mutable bool isDlisQueueActive{false};
   Formula(std::int32_t numberOfAtoms, std::int32_t numberOfClauses);
-  bool isSatisfied() const;
-  bool isUnsatisfied() const;
-  void addClause(std::shared_ptr<Clause> clause);
-  void assignTrue(std::int32_t variable, std::shared_ptr<Clause> antecedent,
-                  std::int32_t decisionLevel);
-  void assignFalse(std::int32_t variable, std::shared_ptr<Clause> antecedent,
-                   std::int32_t decisionLevel);
-  void unassign(std::shared_ptr<Variable> variable);
-  std::int32_t getAnswer() const;
-  bool resolveConflict(std::int32_t decisionLevel,
-                       std::shared_ptr<Clause> conflictClause);
-  float getJeroslowWangHeuristic(std::int32_t literal) const;
-  std::int32_t getSatisfyingClauses(std::int32_t literal) const;
-  void precomputeVsidsScores() const;
-  void updateVsidsScores(const std::set<std::int32_t> &conflictClause) const;
-  void rebalanceVsidsScores() const;
+  static Formula
+  readBlocks(const std::function<std::size_t(char *, std::size_t)> &read);
+  static Formula readClauses(std::vector<DimacsParser> &parsers);
+  static Formula readBinary(const char *begin, const char *end);
+  void assignUnitClauses();
+  void importClause(std::int32_t lbd);
+  std::size_t probe(std::int32_t literal);
+  ClauseReference addClause(const std::vector<std::int32_t> &literals,
+                            bool isLearned);
+  void assign(std::int32_t literal, ClauseReference antecedent,
+              std::int32_t decisionLevel);
+  void backtrack(std::int32_t backtrackLevel);
+  void analyzeConflict(std::int32_t decisionLevel);
+  void collectProofHints();
+  void minimizeLearnedClause();
+  bool isRedundant(std::int32_t literal, std::uint32_t abstractLevels);
+  std::uint32_t getAbstractLevel(std::int32_t variable) const;
+  std::int32_t computeLbd(const std::int32_t *begin, const std::int32_t *end);
+  void updateLearnedClause(ClauseReference reference);
+  void reduceLearnedClauses();
+  bool isLocked(ClauseReference reference) const;
+  void removeClause(ClauseReference reference);
+  void collectGarbage();
+  std::int32_t decideLiteral(ScoreHeap &queue) const;
+  void initializeJeroslowWangQueue() const;
+  void initializeDlisQueue() const;
+  void updateDlisScores(std::int32_t literal, double delta) const;
 };
 
 } // namespace cdclsolve
@@ -0,0 +1,38 @@
+#ifndef CDCLSOLVE_GENERATOR
+#define CDCLSOLVE_GENERATOR
+
+#include "Formula.hpp"
+
+#include <cstdint>
+#include <ostream>
+#include <random>
+#include <vector>
+
+namespace cdclsolve {
+
+class Generator {
+public:
+  struct Cnf {
+    std::int32_t numberOfVariables{0};
+    std::vector<std::vector<std::int32_t>> clauses;
+  };
+  explicit Generator(std::uint32_t seed);
+  Cnf randomKSat(std::int32_t k, std::int32_t numberOfVariables,
+                 double clauseRatio);
+  Cnf parity(std::int32_t numberOfVariables);
+  Cnf graphColoring(std::int32_t numberOfVertices, double averageDegree,
+                    std::int32_t numberOfColors);
+  static Cnf pigeonhole(std::int32_t numberOfHoles);
+  static void writeDimacs(const Cnf &cnf, std::ostream &to);
+  static Formula toFormula(const Cnf &cnf);
+
+private:
+  std::mt19937 generator;
+  std::uint32_t next(std::uint32_t bound);
+  void addXorChain(Cnf &cnf, const std::vector<std::int32_t> &variables,
+                   bool isOdd);
+};
+
+} // namespace cdclsolve
+
+#endif
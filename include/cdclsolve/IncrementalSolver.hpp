@@ -0,0 +1,37 @@
+#ifndef CDCLSOLVE_INCREMENTALSOLVER
+#define CDCLSOLVE_INCREMENTALSOLVER
+
+#include "Formula.hpp"
+#include "Solver.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cdclsolve {
+
+class IncrementalSolver {
+public:
+  explicit IncrementalSolver(const std::string &decisionHeuristic = "vsids",
+                             const std::string &restartStrategy = "glucose");
+  void add(std::int32_t literal);
+  void addClause(const std::vector<std::int32_t> &literals);
+  void assume(std::int32_t literal);
+  Solver::Result solve();
+  std::int32_t value(std::int32_t literal) const;
+  bool failed(std::int32_t literal) const;
+  void interrupt();
+  void setBudget(const Solver::Budget &budget);
+  const Formula &getFormula() const;
+  const Solver &getSolver() const;
+
+private:
+  Formula formula;
+  Solver solver;
+  std::vector<std::int32_t> clause;
+  std::vector<std::int32_t> assumptions;
+};
+
+} // namespace cdclsolve
+
+#endif
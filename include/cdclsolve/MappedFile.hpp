@@ -0,0 +1,30 @@
+#ifndef CDCLSOLVE_MAPPEDFILE
+#define CDCLSOLVE_MAPPEDFILE
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace cdclsolve {
+
+class MappedFile {
+public:
+  explicit MappedFile(const std::string &fileName);
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  ~MappedFile();
+  const char *begin() const;
+  const char *end() const;
+  std::size_t size() const;
+
+private:
+  static constexpr std::size_t READ_BLOCK_SIZE{1 << 20};
+  void *mapping{nullptr};
+  std::size_t mappingSize{0};
+  std::vector<char> buffer;
+  void readAll(int fileDescriptor);
+};
+
+} // namespace cdclsolve
+
+#endif
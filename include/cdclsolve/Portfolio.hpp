@@ -0,0 +1,53 @@
+#ifndef CDCLSOLVE_PORTFOLIO
+#define CDCLSOLVE_PORTFOLIO
+
+#include "ClauseExchange.hpp"
+#include "Formula.hpp"
+#include "Solver.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cdclsolve {
+
+class Portfolio {
+public:
+  using Reporter = std::function<void(std::size_t thread, const Solver &solver,
+                                      Solver::Report report)>;
+  Portfolio(Formula formula, std::size_t numberOfThreads,
+            const std::string &decisionHeuristic,
+            const std::string &restartStrategy, std::size_t shareSize,
+            std::int32_t shareLbd);
+  Solver::Result solve();
+  void interrupt();
+  void setBudget(const Solver::Budget &budget);
+  void enableStatistics();
+  void setReporter(const Reporter &reporter, std::uint64_t conflictInterval);
+  void requestReport(Solver::Report report);
+  const Formula &getFormula() const;
+  const Solver &getSolver() const;
+  const std::vector<Formula> &getFormulas() const;
+
+private:
+  struct Configuration {
+    std::string decisionHeuristic;
+    std::string restartStrategy;
+    bool isPositivePhase;
+  };
+  static const std::vector<Configuration> configurations;
+  std::vector<Formula> formulas;
+  std::unique_ptr<ClauseExchange> clauseExchange;
+  std::vector<std::unique_ptr<Solver>> solvers;
+  std::vector<Solver::Result> results;
+  std::atomic<std::size_t> winner;
+  std::size_t getWinner() const;
+};
+
+} // namespace cdclsolve
+
+#endif
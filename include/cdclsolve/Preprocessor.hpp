@@ -0,0 +1,82 @@
+#ifndef CDCLSOLVE_PREPROCESSOR
+#define CDCLSOLVE_PREPROCESSOR
+
+#include "ProofWriter.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace cdclsolve {
+
+class Preprocessor {
+public:
+  struct Clause {
+    std::size_t begin{0};
+    std::size_t size{0};
+    std::uint64_t id{0};
+    std::uint64_t signature{0};
+    bool isDeleted{false};
+  };
+  Preprocessor(std::int32_t numberOfVariables, ProofWriter *proofWriter,
+               std::uint64_t nextClauseId);
+  void reserve(std::size_t numberOfClauses, std::size_t numberOfLiterals);
+  void addClause(const std::int32_t *begin, const std::int32_t *end,
+                 std::uint64_t id);
+  bool preprocess();
+  const std::vector<Clause> &getClauses() const;
+  const std::int32_t *begin(const Clause &clause) const;
+  const std::int32_t *end(const Clause &clause) const;
+  const std::vector<std::int32_t> &getEliminatedVariables() const;
+  const std::vector<std::int32_t> &getReconstructionStack() const;
+  std::uint64_t getNextClauseId() const;
+
+private:
+  static constexpr std::size_t MAX_OCCURRENCES{32};
+  static constexpr std::size_t MAX_RESOLVENT_SIZE{20};
+  static constexpr std::uint64_t STEP_LIMIT{30000000};
+  static constexpr std::int32_t SUBSUMED{0};
+  static constexpr std::int32_t NOT_SUBSUMED{
+      std::numeric_limits<std::int32_t>::min()};
+  const std::int32_t numberOfVariables;
+  ProofWriter *const proofWriter;
+  std::uint64_t nextClauseId;
+  std::vector<Clause> clauses;
+  std::vector<std::int32_t> literals;
+  std::vector<std::vector<std::size_t>> occurrences;
+  std::vector<std::uint32_t> marks;
+  std::uint32_t mark{0};
+  std::vector<std::int8_t> isEliminated;
+  std::vector<std::int32_t> eliminatedVariables;
+  std::vector<std::int32_t> reconstructionStack;
+  std::vector<std::size_t> queue;
+  std::vector<std::size_t> positive;
+  std::vector<std::size_t> negative;
+  std::vector<std::int32_t> resolvent;
+  std::vector<std::int32_t> resolvents;
+  std::vector<std::size_t> resolventEnds;
+  std::vector<std::pair<std::uint64_t, std::uint64_t>> antecedents;
+  std::uint64_t steps{0};
+  bool isUnsatisfiable{false};
+  bool hasLiteral(const Clause &clause, std::int32_t literal) const;
+  void subsume();
+  std::int32_t subsumes(const Clause &subsuming, const Clause &subsumed);
+  void strengthen(std::size_t index, std::int32_t literal,
+                  std::uint64_t antecedent);
+  void eliminate();
+  void eliminate(std::int32_t variable);
+  bool resolve(const Clause &first, const Clause &second,
+               std::int32_t variable);
+  void addResolvent(const std::int32_t *begin, const std::int32_t *end,
+                    std::pair<std::uint64_t, std::uint64_t> antecedents);
+  void removeClause(std::size_t index);
+  void markLiterals(const Clause &clause);
+  bool isMarked(std::int32_t literal) const;
+  std::uint64_t getSignature(const Clause &clause) const;
+};
+
+} // namespace cdclsolve
+
+#endif
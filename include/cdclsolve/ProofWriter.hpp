@@ -0,0 +1,56 @@
+#ifndef CDCLSOLVE_PROOFWRITER
+#define CDCLSOLVE_PROOFWRITER
+
+#include "RingBuffer.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cdclsolve {
+
+class ProofWriter {
+public:
+  ProofWriter(const std::string &fileName, const std::string &format);
+  ProofWriter(const ProofWriter &) = delete;
+  ProofWriter &operator=(const ProofWriter &) = delete;
+  ~ProofWriter();
+  bool hasHints() const;
+  void addClause(std::uint64_t id, const std::int32_t *begin,
+                 const std::int32_t *end,
+                 const std::vector<std::uint64_t> &hints);
+  void deleteClause(std::uint64_t id, const std::int32_t *begin,
+                    const std::int32_t *end);
+
+private:
+  enum class Format { DRAT, BINARY_DRAT, LRAT };
+  static const std::map<std::string, Format> formatMap;
+  static constexpr std::size_t QUEUE_SIZE{1 << 24};
+  static constexpr std::size_t WRITE_SIZE{1 << 20};
+  static constexpr std::size_t MAX_INTEGER_LENGTH{20};
+  static constexpr char BINARY_ADD{'a'};
+  static constexpr char BINARY_DELETE{'d'};
+  static constexpr int IDLE_MICROSECONDS{200};
+  const Format format;
+  std::ofstream to;
+  RingBuffer queue;
+  std::vector<char> record;
+  std::uint64_t lastId{0};
+  std::atomic<bool> isClosed{false};
+  std::thread writer;
+  void appendLiterals(const std::int32_t *begin, const std::int32_t *end);
+  void append(char c);
+  void append(std::int64_t integer);
+  void appendBinary(std::int32_t literal);
+  void push();
+  void run();
+};
+
+} // namespace cdclsolve
+
+#endif
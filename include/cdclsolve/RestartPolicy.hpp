@@ -0,0 +1,42 @@
+#ifndef CDCLSOLVE_RESTARTPOLICY
+#define CDCLSOLVE_RESTARTPOLICY
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace cdclsolve {
+
+class RestartPolicy {
+public:
+  explicit RestartPolicy(const std::string &strategy);
+  void registerConflict(std::int32_t lbd);
+  bool isRestartDue() const;
+  void restart();
+  std::uint64_t getRestarts() const;
+  std::uint64_t getRestartInterval() const;
+
+private:
+  enum class Strategy { NONE, LUBY, GEOMETRIC, GLUCOSE };
+  static const std::map<std::string, Strategy> strategyMap;
+  static constexpr std::uint64_t LUBY_UNIT{100};
+  static constexpr std::uint64_t GEOMETRIC_FIRST{100};
+  static constexpr double GEOMETRIC_FACTOR{1.5};
+  static constexpr std::uint64_t GLUCOSE_MIN_CONFLICTS{50};
+  static constexpr double GLUCOSE_MARGIN{1.25};
+  static constexpr double FAST_EMA_ALPHA{1.0 / 32.0};
+  static constexpr double SLOW_EMA_ALPHA{1.0 / 4096.0};
+  const Strategy strategy;
+  std::uint64_t restarts{0};
+  std::uint64_t conflictsSinceRestart{0};
+  std::uint64_t restartInterval{0};
+  std::uint64_t conflicts{0};
+  double fastLbdAverage{0.0};
+  double slowLbdAverage{0.0};
+  static std::uint64_t luby(std::uint64_t index);
+  void updateRestartInterval();
+};
+
+} // namespace cdclsolve
+
+#endif
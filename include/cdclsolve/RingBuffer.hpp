@@ -0,0 +1,26 @@
+#ifndef CDCLSOLVE_RINGBUFFER
+#define CDCLSOLVE_RINGBUFFER
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace cdclsolve {
+
+class RingBuffer {
+public:
+  explicit RingBuffer(std::size_t capacity);
+  void push(const char *data, std::size_t size);
+  std::size_t pop(char *data, std::size_t size);
+
+private:
+  static constexpr std::size_t CACHE_LINE_SIZE{64};
+  std::vector<char> buffer;
+  const std::size_t mask;
+  alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head{0};
+  alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail{0};
+};
+
+} // namespace cdclsolve
+
+#endif
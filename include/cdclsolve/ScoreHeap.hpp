@@ -0,0 +1,33 @@
+#ifndef CDCLSOLVE_SCOREHEAP
+#define CDCLSOLVE_SCOREHEAP
+
+#include <cstddef>
+#include <vector>
+
+namespace cdclsolve {
+
+class ScoreHeap {
+public:
+  explicit ScoreHeap(std::size_t size);
+  void resize(std::size_t size);
+  std::size_t getSize() const;
+  double getScore(std::size_t index) const;
+  void setScore(std::size_t index, double score);
+  void scale(double factor);
+  void insert(std::size_t index);
+  bool contains(std::size_t index) const;
+  bool isEmpty() const;
+  std::size_t removeMax();
+
+private:
+  static constexpr std::size_t NOT_IN_HEAP{static_cast<std::size_t>(-1)};
+  std::vector<double> scores;
+  std::vector<std::size_t> heap;
+  std::vector<std::size_t> positions;
+  void siftUp(std::size_t position);
+  void siftDown(std::size_t position);
+};
+
+} // namespace cdclsolve
+
+#endif
@@ -0,0 +1,39 @@
+#ifndef CDCLSOLVE_SIGNALWATCHER
+#define CDCLSOLVE_SIGNALWATCHER
+
+#include <chrono>
+#include <csignal>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace cdclsolve {
+
+class SignalWatcher {
+public:
+  explicit SignalWatcher(std::chrono::steady_clock::duration timerInterval);
+  ~SignalWatcher();
+  SignalWatcher(const SignalWatcher &) = delete;
+  SignalWatcher &operator=(const SignalWatcher &) = delete;
+  void setHandler(std::function<void()> handler);
+  void setDumpHandler(std::function<void()> handler);
+  void setTimerHandler(std::function<void()> handler);
+
+private:
+  const std::chrono::steady_clock::duration timerInterval;
+  sigset_t signals;
+  sigset_t previousSignals;
+  std::mutex mutex;
+  std::function<void()> handler;
+  std::function<void()> dumpHandler;
+  std::function<void()> timerHandler;
+  bool isSignaled{false};
+  bool isStopped{false};
+  std::thread thread;
+  void watch();
+  int waitForSignal(std::chrono::steady_clock::time_point deadline);
+};
+
+} // namespace cdclsolve
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef CDCLSOLVE_SOLUTIONWRITER
+#define CDCLSOLVE_SOLUTIONWRITER
+
+#include "Formula.hpp"
+#include "Solver.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cdclsolve {
+
+class SolutionWriter {
+public:
+  SolutionWriter(std::ostream &to, const std::string &format);
+  void write(const Formula &formula, Solver::Result result);
+
+private:
+  enum class Format { QDIMACS, COMPETITION };
+  static const std::map<std::string, Format> formatMap;
+  static constexpr std::string_view SOLUTION_LINE_S{"s"};
+  static constexpr std::string_view SOLUTION_LINE_CNF{"cnf"};
+  static constexpr std::string_view CERT_LINE_V{"V"};
+  static constexpr std::string_view SOLUTION_SATISFIABLE{"SATISFIABLE"};
+  static constexpr std::string_view SOLUTION_UNSATISFIABLE{"UNSATISFIABLE"};
+  static constexpr std::string_view SOLUTION_UNKNOWN{"UNKNOWN"};
+  static constexpr std::string_view VALUE_LINE_V{"v"};
+  static constexpr std::size_t VALUE_LINE_LENGTH{78};
+  static constexpr std::size_t BUFFER_SIZE{1 << 16};
+  static constexpr std::size_t MAX_INTEGER_LENGTH{11};
+  std::ostream &to;
+  const Format format;
+  std::vector<char> buffer;
+  std::size_t size{0};
+  void writeQdimacs(const Formula &formula, Solver::Result result);
+  void writeCompetition(const Formula &formula, Solver::Result result);
+  void append(std::string_view text);
+  void append(char c);
+  std::size_t append(std::int32_t integer);
+  void flush();
+};
+
+} // namespace cdclsolve
+
+#endif
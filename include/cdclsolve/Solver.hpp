@@ -2,48 +2,90 @@
 #define CDCLSOLVE_SOLVER
 
 #include "Formula.hpp"
+#include "RestartPolicy.hpp"
+#include "Statistics.hpp"
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace cdclsolve {
 
 class Solver {
 public:
-  enum class Result { SAT, UNSAT };
-  Solver(Formula &formula, const std::string &decisionHeuristic);
+  enum class Result { SAT, UNSAT, UNKNOWN };
+  enum class Report { PROGRESS, STATISTICS };
+  using Reporter = std::function<void(const Solver &solver, Report report)>;
+  struct Budget {
+    std::uint64_t conflicts{0};
+    std::uint64_t propagations{0};
+    std::chrono::steady_clock::duration time{
+        std::chrono::steady_clock::duration::zero()};
+    // Peak resident memory of the whole process, not only of this solver.
+    std::size_t memory{0};
+  };
+  Solver(Formula &formula, const std::string &decisionHeuristic,
+         const std::string &restartStrategy);
   Result solve();
-  std::chrono::steady_clock::duration
-  getDurationBooleanConstraintPropagation() const;
-  double getRelativeDurationBooleanConstraintPropagation() const;
-  std::chrono::steady_clock::duration getDurationDecision() const;
-  double getRelativeDurationDecision() const;
-  std::chrono::steady_clock::duration getDurationConflictResolution() const;
-  double getRelativeDurationConflictResolution() const;
+  Result solve(const std::vector<std::int32_t> &assumptions);
+  void interrupt();
+  void setBudget(const Budget &budget);
+  void setReporter(Reporter reporter, std::uint64_t conflictInterval);
+  void requestReport(Report report);
+  const std::vector<std::int32_t> &getFailedAssumptions() const;
+  void enableStatistics();
+  const Statistics &getStatistics() const;
+  const Formula &getFormula() const;
+  std::uint64_t getRestarts() const;
+  std::uint64_t getRestartInterval() const;
   std::chrono::steady_clock::duration getDurationTotal() const;
-  double getRelativeDurationTotal() const;
+  std::chrono::steady_clock::duration getDurationCpu() const;
 
 private:
+  static constexpr std::uint64_t BUDGET_CHECK_INTERVAL{1 << 6};
+  static constexpr std::uint64_t NO_REPORT{UINT64_MAX};
   using decisionFunction = std::function<std::int32_t(const Formula &formula)>;
   static const std::map<std::string, decisionFunction> decisionHeuristicMap;
   const decisionFunction decide;
   Formula &formula;
-  std::chrono::steady_clock::duration durationBooleanConstraintPropagation{
-      std::chrono::steady_clock::duration::zero()};
-  std::chrono::steady_clock::duration durationDecision{
-      std::chrono::steady_clock::duration::zero()};
-  std::chrono::steady_clock::duration durationConflictResolution{
-      std::chrono::steady_clock::duration::zero()};
+  RestartPolicy restartPolicy;
+  Statistics statistics;
+  bool isStatisticsEnabled{false};
   std::chrono::steady_clock::duration durationTotal{
       std::chrono::steady_clock::duration::zero()};
+  std::chrono::steady_clock::time_point solveStart;
+  Statistics::ThreadClock::duration durationCpu{
+      Statistics::ThreadClock::duration::zero()};
+  Statistics::ThreadClock::time_point solveStartCpu;
   std::int32_t decisionLevel{0};
+  std::vector<std::int32_t> assumptions;
+  std::vector<std::int32_t> failedAssumptions;
+  std::atomic<bool> isInterrupted{false};
+  Budget budget;
+  std::uint64_t budgetConflicts{0};
+  std::uint64_t budgetPropagations{0};
+  std::chrono::steady_clock::time_point budgetDeadline;
+  std::uint64_t budgetChecks{0};
+  Reporter reporter;
+  std::uint64_t reportInterval{0};
+  std::uint64_t nextReport{NO_REPORT};
+  std::atomic<std::uint32_t> reportRequests{0};
   Result doSolve();
+  bool isBudgetExhausted();
+  void doReport();
   void doBooleanConstraintPropagation();
   void doDecision();
+  bool doAssumption();
   void doConflictResolution();
+  void doRestart();
+  Statistics::ThreadClock::time_point startSample(Statistics::Phase phase);
+  void stopSample(Statistics::Phase phase,
+                  Statistics::ThreadClock::time_point start);
 };
 
 } // namespace cdclsolve
@@ -0,0 +1,52 @@
+#ifndef CDCLSOLVE_STATISTICS
+#define CDCLSOLVE_STATISTICS
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace cdclsolve {
+
+class Statistics {
+public:
+  enum class Phase { PROPAGATION, DECISION, CONFLICT_RESOLUTION, REDUCTION };
+  static constexpr std::size_t NUMBER_OF_PHASES{4};
+  static constexpr std::size_t HISTOGRAM_SIZE{16};
+  using Histogram = std::array<std::uint64_t, HISTOGRAM_SIZE>;
+  struct ThreadClock {
+    using duration = std::chrono::steady_clock::duration;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<ThreadClock>;
+    static constexpr bool is_steady{true};
+    static time_point now();
+  };
+  void addDecision();
+  void addConflict(std::size_t learnedClauseSize, std::int32_t lbd,
+                   std::int32_t backjumpDistance);
+  ThreadClock::time_point startSample(Phase phase);
+  void stopSample(Phase phase, ThreadClock::time_point start);
+  std::uint64_t getDecisions() const;
+  const Histogram &getLearnedClauseSizes() const;
+  const Histogram &getLbds() const;
+  const Histogram &getBackjumpDistances() const;
+  std::chrono::steady_clock::duration getDuration(Phase phase) const;
+  static std::uint64_t getBucketBound(std::size_t bucket);
+
+private:
+  static constexpr std::uint64_t SAMPLE_INTERVAL{1 << 6};
+  std::uint64_t decisions{0};
+  Histogram learnedClauseSizes{};
+  Histogram lbds{};
+  Histogram backjumpDistances{};
+  std::array<std::uint64_t, NUMBER_OF_PHASES> calls{};
+  std::array<std::uint64_t, NUMBER_OF_PHASES> samples{};
+  std::array<std::chrono::steady_clock::duration, NUMBER_OF_PHASES>
+      sampledDurations{};
+  static std::size_t getBucket(std::uint64_t value);
+};
+
+} // namespace cdclsolve
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef CDCLSOLVE_STATISTICSWRITER
+#define CDCLSOLVE_STATISTICSWRITER
+
+#include "CubeAndConquer.hpp"
+#include "Formula.hpp"
+#include "Solver.hpp"
+#include "Statistics.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace cdclsolve {
+
+class StatisticsWriter {
+public:
+  StatisticsWriter(std::ostream &to, const std::string &format);
+  void write(const Solver &solver);
+  void write(const Solver &solver, const std::vector<Formula> &formulas);
+  void write(const Solver &solver, const CubeAndConquer &cubeAndConquer);
+  void writeProgress(std::size_t thread, const Solver &solver);
+
+private:
+  enum class Format { TEXT, JSON };
+  struct Progress {
+    std::chrono::steady_clock::time_point time;
+    std::uint64_t conflicts{0};
+    std::uint64_t propagations{0};
+  };
+  using Counters = std::vector<std::pair<std::string, std::uint64_t>>;
+  using Histograms =
+      std::vector<std::pair<std::string_view, const Statistics::Histogram *>>;
+  using Durations = std::vector<
+      std::pair<std::string_view, std::chrono::steady_clock::duration>>;
+  static const std::map<std::string, Format> formatMap;
+  static const std::map<Solver::Result, std::string> resultMap;
+  static constexpr std::string_view RESIDENT_MEMORY_FILE{"/proc/self/statm"};
+  std::ostream &to;
+  const Format format;
+  const std::chrono::steady_clock::time_point start;
+  std::vector<Progress> progress;
+  void write(const Solver &solver, const Counters &threadCounters,
+             const CubeAndConquer *cubeAndConquer);
+  void writeText(const Counters &counters, const Histograms &histograms,
+                 const Durations &durations,
+                 const CubeAndConquer *cubeAndConquer);
+  void writeJson(const Counters &counters, const Histograms &histograms,
+                 const Durations &durations,
+                 const CubeAndConquer *cubeAndConquer);
+  static double toSeconds(std::chrono::steady_clock::duration duration);
+  static std::uint64_t perSecond(std::uint64_t count, double seconds);
+  static std::size_t getResidentMemory();
+};
+
+} // namespace cdclsolve
+
+#endif
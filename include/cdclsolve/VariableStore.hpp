@@ -0,0 +1,66 @@
+#ifndef CDCLSOLVE_VARIABLESTORE
+#define CDCLSOLVE_VARIABLESTORE
+
+#include "ClauseArena.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+namespace cdclsolve {
+
+class VariableStore {
+public:
+  explicit VariableStore(std::int32_t numberOfVariables);
+  void resize(std::int32_t numberOfVariables);
+  static std::size_t getLiteralIndex(std::int32_t literal) {
+    return 2 * static_cast<std::size_t>(std::abs(literal)) + (literal < 0);
+  }
+  static std::int32_t getLiteral(std::size_t index) {
+    const auto variable{static_cast<std::int32_t>(index / 2)};
+    return index % 2 == 0 ? variable : -variable;
+  }
+  std::int32_t getNumberOfVariables() const;
+  void assign(std::int32_t literal, ClauseReference reason,
+              std::int32_t decisionLevel);
+  void unassign(std::int32_t variable);
+  void setValue(std::int32_t literal);
+  bool isAssigned(std::int32_t variable) const {
+    return values[2 * static_cast<std::size_t>(variable)] != UNASSIGNED;
+  }
+  bool isTrue(std::int32_t literal) const {
+    return values[getLiteralIndex(literal)] == TRUE;
+  }
+  bool isFalse(std::int32_t literal) const {
+    return values[getLiteralIndex(literal)] == FALSE;
+  }
+  std::int32_t getDecisionLevel(std::int32_t variable) const {
+    return levels[variable];
+  }
+  ClauseReference getReason(std::int32_t variable) const {
+    return reasons[variable];
+  }
+  void setReason(std::int32_t variable, ClauseReference reason) {
+    reasons[variable] = reason;
+  }
+  std::int32_t getSavedLiteral(std::int32_t variable) const {
+    return phases[variable] == TRUE ? variable : -variable;
+  }
+  void setSavedLiteral(std::int32_t literal) {
+    phases[std::abs(literal)] = literal > 0 ? TRUE : FALSE;
+  }
+
+private:
+  static constexpr std::int8_t UNASSIGNED{0};
+  static constexpr std::int8_t TRUE{1};
+  static constexpr std::int8_t FALSE{-1};
+  std::vector<std::int8_t> values;
+  std::vector<std::int32_t> levels;
+  std::vector<ClauseReference> reasons;
+  std::vector<std::int8_t> phases;
+};
+
+} // namespace cdclsolve
+
+#endif
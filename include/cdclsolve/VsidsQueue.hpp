@@ -0,0 +1,32 @@
+#ifndef CDCLSOLVE_VSIDSQUEUE
+#define CDCLSOLVE_VSIDSQUEUE
+
+#include "ScoreHeap.hpp"
+
+#include <cstdint>
+
+namespace cdclsolve {
+
+class VsidsQueue {
+public:
+  explicit VsidsQueue(std::int32_t numberOfVariables);
+  void resize(std::int32_t numberOfVariables);
+  void bump(std::int32_t variable);
+  void decay();
+  void insert(std::int32_t variable);
+  bool isEmpty() const;
+  std::int32_t removeMax();
+  double getActivity(std::int32_t variable) const;
+  void setActivity(std::int32_t variable, double activity);
+
+private:
+  static constexpr double DECAY{0.95};
+  static constexpr double RESCALE_LIMIT{1e100};
+  ScoreHeap heap;
+  double increment{1.0};
+  void rescale();
+};
+
+} // namespace cdclsolve
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef CDCLSOLVE_WORKSTEALINGDEQUE
+#define CDCLSOLVE_WORKSTEALINGDEQUE
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace cdclsolve {
+
+class WorkStealingDeque {
+public:
+  void push(std::size_t item);
+  bool pop(std::size_t &item);
+  bool steal(std::size_t &item);
+
+private:
+  std::deque<std::size_t> items;
+  std::mutex mutex;
+};
+
+} // namespace cdclsolve
+
+#endif
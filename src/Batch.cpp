@@ -0,0 +1,221 @@
+#include <cdclsolve/Batch.hpp>
+
+#include <cdclsolve/SolutionWriter.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+
+const std::map<std::string, cdclsolve::Batch::Format>
+    cdclsolve::Batch::formatMap{{"jsonl", Format::JSON}, {"csv", Format::CSV}};
+
+const std::map<cdclsolve::Solver::Result, std::string>
+    cdclsolve::Batch::resultMap{{Solver::Result::SAT, "SAT"},
+                                {Solver::Result::UNSAT, "UNSAT"},
+                                {Solver::Result::UNKNOWN, "UNKNOWN"}};
+
+cdclsolve::Batch::Batch(const std::string &listOrDirectory,
+                        std::size_t numberOfJobs,
+                        const Solver::Budget &budget,
+                        const std::string &decisionHeuristic,
+                        const std::string &restartStrategy,
+                        bool isPreprocessing)
+    : numberOfJobs{numberOfJobs}, budget{budget},
+      decisionHeuristic{decisionHeuristic}, restartStrategy{restartStrategy},
+      isPreprocessing{isPreprocessing}, jobs(numberOfJobs, nullptr) {
+  if (numberOfJobs == 0) {
+    throw std::invalid_argument("batch mode needs at least one job");
+  }
+  if (std::filesystem::is_directory(listOrDirectory)) {
+    for (const auto &entry :
+         std::filesystem::directory_iterator{listOrDirectory}) {
+      if (entry.is_regular_file()) {
+        fileNames.push_back(entry.path().string());
+      }
+    }
+    std::sort(fileNames.begin(), fileNames.end());
+    return;
+  }
+  std::ifstream list{listOrDirectory};
+  if (!list) {
+    throw std::runtime_error("cannot open batch list: " + listOrDirectory);
+  }
+  for (std::string line; std::getline(list, line);) {
+    if (!line.empty()) {
+      fileNames.push_back(line);
+    }
+  }
+}
+
+void cdclsolve::Batch::solve(std::ostream &to, const std::string &recordFormat,
+                             const std::string &outputDirectory,
+                             const std::string &solutionFormat) {
+  const auto format{formatMap.at(recordFormat)};
+  if (!outputDirectory.empty()) {
+    std::set<std::string> solutionNames;
+    for (const auto &fileName : fileNames) {
+      if (!solutionNames
+               .insert(std::filesystem::path{fileName}.filename().string())
+               .second) {
+        throw std::invalid_argument(
+            "batch files with the same name overwrite each other's "
+            "solution: " +
+            fileName);
+      }
+    }
+  }
+  if (format == Format::CSV) {
+    to << CSV_HEADER << '\n';
+  }
+  std::atomic<std::size_t> next{0};
+  std::mutex outputMutex;
+  std::vector<std::thread> threads;
+  for (std::size_t j{0}; j < numberOfJobs; ++j) {
+    threads.emplace_back([&, j] {
+      for (auto i{next++}; i < fileNames.size(); i = next++) {
+        bool isSkipped{false};
+        {
+          std::lock_guard<std::mutex> lock{mutex};
+          isSkipped = isInterrupted;
+        }
+        const auto record{
+            isSkipped ? Record{fileNames[i],
+                               resultMap.at(Solver::Result::UNKNOWN), 0.0,
+                               0.0, 0, std::string{INTERRUPTED}}
+                      : solveFile(j, fileNames[i], outputDirectory,
+                                  solutionFormat)};
+        const auto line{formatRecord(record, format)};
+        std::lock_guard<std::mutex> lock{outputMutex};
+        to << line << '\n';
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  to.flush();
+}
+
+void cdclsolve::Batch::interrupt() {
+  std::lock_guard<std::mutex> lock{mutex};
+  isInterrupted = true;
+  for (const auto solver : jobs) {
+    if (solver != nullptr) {
+      solver->interrupt();
+    }
+  }
+}
+
+cdclsolve::Batch::Record
+cdclsolve::Batch::solveFile(std::size_t job, const std::string &fileName,
+                            const std::string &outputDirectory,
+                            const std::string &solutionFormat) {
+  Record record{fileName};
+  try {
+    auto start{std::chrono::steady_clock::now()};
+    auto formula{Formula::readInput(fileName)};
+    record.durationRead = std::chrono::duration<double>(
+                              std::chrono::steady_clock::now() - start)
+                              .count();
+    start = std::chrono::steady_clock::now();
+    if (isPreprocessing) {
+      formula.preprocess();
+    }
+    Solver solver{formula, decisionHeuristic, restartStrategy};
+    solver.setBudget(budget);
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      jobs[job] = &solver;
+      if (isInterrupted) {
+        solver.interrupt();
+      }
+    }
+    const auto result{solver.solve()};
+    {
+      std::lock_guard<std::mutex> lock{mutex};
+      jobs[job] = nullptr;
+    }
+    record.durationSolve = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+    record.result = resultMap.at(result);
+    if (result == Solver::Result::UNKNOWN) {
+      std::lock_guard<std::mutex> lock{mutex};
+      if (isInterrupted) {
+        record.error = INTERRUPTED;
+      }
+    }
+    record.conflicts = formula.getConflicts();
+    if (!outputDirectory.empty()) {
+      std::ofstream output{
+          (std::filesystem::path{outputDirectory} /
+           (std::filesystem::path{fileName}.filename().string() +
+            std::string{SOLUTION_EXTENSION}))
+              .string()};
+      SolutionWriter writer{output, solutionFormat};
+      writer.write(formula, result);
+    }
+  } catch (const std::exception &exception) {
+    record.result = "ERROR";
+    record.error = exception.what();
+  }
+  return record;
+}
+
+std::string cdclsolve::Batch::formatRecord(const Record &record,
+                                           Format format) {
+  std::ostringstream line;
+  if (format == Format::JSON) {
+    line << "{\"file\":" << quoteJson(record.fileName) << ",\"result\":\""
+         << record.result << "\",\"read\":" << record.durationRead
+         << ",\"solve\":" << record.durationSolve
+         << ",\"conflicts\":" << record.conflicts;
+    if (!record.error.empty()) {
+      line << ",\"error\":" << quoteJson(record.error);
+    }
+    line << '}';
+  } else {
+    line << quoteCsv(record.fileName) << ',' << record.result << ','
+         << record.durationRead << ',' << record.durationSolve << ','
+         << record.conflicts << ',' << quoteCsv(record.error);
+  }
+  return line.str();
+}
+
+std::string cdclsolve::Batch::quoteJson(const std::string &text) {
+  std::string quoted{"\""};
+  for (const auto c : text) {
+    if (c == '"' || c == '\\') {
+      quoted += '\\';
+      quoted += c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      char escape[7];
+      std::snprintf(escape, sizeof(escape), "\\u%04x", c);
+      quoted += escape;
+    } else {
+      quoted += c;
+    }
+  }
+  return quoted + '"';
+}
+
+std::string cdclsolve::Batch::quoteCsv(const std::string &text) {
+  if (text.find_first_of(",\"\n") == std::string::npos) {
+    return text;
+  }
+  std::string quoted{"\""};
+  for (const auto c : text) {
+    if (c == '"') {
+      quoted += '"';
+    }
+    quoted += c;
+  }
+  return quoted + '"';
+}
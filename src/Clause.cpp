@@ -1,224 +1,66 @@
 #include <cdclsolve/Clause.hpp>
+#include <cdclsolve/VariableStore.hpp>
 
 #include <algorithm>
-#include <iterator>
+#include <cstdlib>
+#include <cstring>
 
-cdclsolve::Clause::Clause(
-    std::vector<std::pair<std::shared_ptr<Variable>, bool>> variables)
-    : variables{variables} {
-  watch0 = 0;
-  watch1 = variables.size() > 1 ? 1 : 0;
-}
-
-std::size_t cdclsolve::Clause::size() const { return variables.size(); }
-
-bool cdclsolve::Clause::hasLiteral(std::int32_t literal) const {
-  return std::find_if(
-             variables.cbegin(), variables.cend(),
-             [literal](const std::pair<std::shared_ptr<Variable>, bool> &p) {
-               return (p.first->getValue() == std::abs(literal)) &&
-                      (p.second == literal > 0);
-             }) != variables.cend();
-}
-
-void cdclsolve::Clause::setSatisfied(std::int32_t variable) const {
-  if (isSatisfied(variables[watch0]) || isSatisfied(variables[watch1])) {
-    return;
+void cdclsolve::Clause::setFlag(std::int32_t flag, bool isSet) {
+  if (isSet) {
+    header[1] |= flag;
+  } else {
+    header[1] &= ~flag;
   }
-  auto it{std::find_if(
-      variables.cbegin(), variables.cend(),
-      [variable](const std::pair<std::shared_ptr<Variable>, bool> &p) {
-        return std::abs(p.first->getValue()) == std::abs(variable);
-      })};
-  if (it == variables.cend()) {
-    return;
-  }
-  watch0 = std::distance(variables.cbegin(), it);
 }
 
-void cdclsolve::Clause::setUnsatisfied(std::int32_t variable) const {
-  auto it{std::find_if(
-      variables.cbegin(), variables.cend(),
-      [variable](const std::pair<std::shared_ptr<Variable>, bool> &p) {
-        return std::abs(p.first->getValue()) == std::abs(variable);
-      })};
-  if (it == variables.cend()) {
-    return;
-  }
-  if (watch0 == std::distance(variables.cbegin(), it)) {
-    auto it2{std::find_if(
-        variables.cbegin(), variables.cend(),
-        [this](const std::pair<std::shared_ptr<Variable>, bool> &p) {
-          return !p.first->isAssigned() && p.first != variables[watch1].first;
-        })};
-    if (it2 != variables.cend()) {
-      watch0 = std::distance(variables.cbegin(), it2);
-    }
-  }
-  if (watch1 == std::distance(variables.cbegin(), it)) {
-    auto it2{std::find_if(
-        variables.cbegin(), variables.cend(),
-        [this](const std::pair<std::shared_ptr<Variable>, bool> &p) {
-          return !p.first->isAssigned() && p.first != variables[watch0].first;
-        })};
-    if (it2 != variables.cend()) {
-      watch1 = std::distance(variables.cbegin(), it2);
-    }
-  }
+cdclsolve::Clause::Tier cdclsolve::Clause::getTier() const {
+  return static_cast<Tier>((header[1] & TIER_MASK) >> TIER_SHIFT);
 }
 
-bool cdclsolve::Clause::isSatisfied() const {
-  if (variables.empty()) {
-    return false;
-  }
-  return isSatisfied(variables[watch0]) || isSatisfied(variables[watch1]);
+void cdclsolve::Clause::setTier(Tier tier) {
+  header[1] = (header[1] & ~TIER_MASK) |
+              (static_cast<std::int32_t>(tier) << TIER_SHIFT);
 }
 
-bool cdclsolve::Clause::isUnsatisfied() const {
-  if (variables.empty()) {
-    return true;
-  }
-  return isUnsatisfied(variables[watch0]) && isUnsatisfied(variables[watch1]);
+std::int32_t cdclsolve::Clause::getLbd() const {
+  return header[1] >> FLAG_BITS;
 }
 
-bool cdclsolve::Clause::isUnit() const {
-  if (variables.empty()) {
-    return false;
-  }
-  if (watch0 == watch1 && !isUnsatisfied(variables[watch0])) {
-    return true;
-  }
-  return (isUnsatisfied(variables[watch0]) &&
-          isUnassigned(variables[watch1])) ||
-         (isUnassigned(variables[watch0]) && isUnsatisfied(variables[watch1]));
+void cdclsolve::Clause::setLbd(std::int32_t lbd) {
+  header[1] = (header[1] & FLAG_MASK) | (lbd << FLAG_BITS);
 }
 
-bool cdclsolve::Clause::isUndecided() const {
-  return !isSatisfied() && !isUnsatisfied() && !isUnit();
+float cdclsolve::Clause::getActivity() const {
+  float activity;
+  std::memcpy(&activity, &header[2], sizeof(activity));
+  return activity;
 }
 
-bool cdclsolve::Clause::isSatisfying(std::int32_t literal) const {
-  return std::find_if(
-             variables.cbegin(), variables.cend(),
-             [literal](const std::pair<std::shared_ptr<Variable>, bool> &p) {
-               return p.first->getValue() == std::abs(literal) &&
-                      (p.second == literal > 0) && !p.first->isAssigned();
-             }) != variables.cend();
+void cdclsolve::Clause::setActivity(float activity) {
+  std::memcpy(&header[2], &activity, sizeof(activity));
 }
 
-std::int32_t cdclsolve::Clause::getSatisfyingAssignment() const {
-  if (!variables[watch0].first->isAssigned()) {
-    return variables[watch0].second ? variables[watch0].first->getValue()
-                                    : -variables[watch0].first->getValue();
-  }
-  if (!variables[watch1].first->isAssigned()) {
-    return variables[watch1].second ? variables[watch1].first->getValue()
-                                    : -variables[watch1].first->getValue();
-  }
-  return 0;
+std::uint32_t cdclsolve::Clause::getRelocation() const {
+  return static_cast<std::uint32_t>(header[2]);
 }
 
-std::set<std::int32_t> cdclsolve::Clause::getLiterals() const {
-  std::set<std::int32_t> literals;
-  for (const auto &[v, b] : variables) {
-    literals.insert(b ? v->getValue() : -v->getValue());
-  }
-  return literals;
-}
-
-std::vector<std::int32_t> cdclsolve::Clause::getLiteralsAsVector() const {
-  std::vector<std::int32_t> literals;
-  for (const auto &[v, b] : variables) {
-    literals.push_back(b ? v->getValue() : -v->getValue());
-  }
-  return literals;
-}
-
-bool cdclsolve::Clause::resolve(std::shared_ptr<const Clause> clause) {
-  bool isModified{false};
-  for (const auto &literal : clause->getLiterals()) {
-    const auto it{std::find_if(
-        variables.cbegin(), variables.cend(),
-        [literal](const std::pair<std::shared_ptr<Variable>, bool> &p) {
-          return (p.first->getValue() == std::abs(literal)) &&
-                 (p.second != literal > 0);
-        })};
-    if (it != variables.cend()) {
-      variables.erase(it);
-      isModified = true;
-    } else {
-      const auto it{std::find_if(
-          variables.cbegin(), variables.cend(),
-          [literal](const std::pair<std::shared_ptr<Variable>, bool> &p) {
-            return (p.first->getValue() == std::abs(literal)) &&
-                   (p.second == literal > 0);
-          })};
-      if (it == variables.cend()) {
-        variables.push_back(*std::find_if(
-            clause->variables.cbegin(), clause->variables.cend(),
-            [literal](const std::pair<std::shared_ptr<Variable>, bool> &p) {
-              return p.first->getValue() == std::abs(literal);
-            }));
-        isModified = true;
-      }
-    }
-  }
-  if (isModified) {
-    updateWatches();
-  }
-  return isModified;
+void cdclsolve::Clause::setRelocation(std::uint32_t reference) {
+  setFlag(FLAG_RELOCATED, true);
+  header[2] = static_cast<std::int32_t>(reference);
 }
 
-bool cdclsolve::Clause::isSatisfied(
-    const std::pair<std::shared_ptr<Variable>, bool> &variable) const {
-  return (variable.first->isTrue() && variable.second) ||
-         (variable.first->isFalse() && !variable.second);
-}
-
-bool cdclsolve::Clause::isUnsatisfied(
-    const std::pair<std::shared_ptr<Variable>, bool> &variable) const {
-  return (variable.first->isTrue() && !variable.second) ||
-         (variable.first->isFalse() && variable.second);
+bool cdclsolve::Clause::hasLiteral(std::int32_t literal) const {
+  return std::find(begin(), end(), literal) != end();
 }
 
-bool cdclsolve::Clause::isUnassigned(
-    const std::pair<std::shared_ptr<Variable>, bool> &variable) const {
-  return !variable.first->isAssigned();
+bool cdclsolve::Clause::isSatisfied(const VariableStore &variables) const {
+  return std::any_of(begin(), end(), [&variables](std::int32_t l) {
+    return variables.isTrue(l);
+  });
 }
 
-void cdclsolve::Clause::updateWatches() const {
-  watch0 = 0;
-  watch1 = variables.size() > 1 ? 1 : 0;
-  if (variables.size() < 3) {
-    return;
-  }
-  auto it{
-      std::find_if(variables.cbegin(), variables.cend(),
-                   [this](const std::pair<std::shared_ptr<Variable>, bool> &p) {
-                     return isSatisfied(p);
-                   })};
-  if (it != variables.cend()) {
-    watch0 = std::distance(variables.cbegin(), it);
-    return;
-  }
-  if (isUnsatisfied(variables[watch0])) {
-    auto it{std::find_if(
-        variables.cbegin(), variables.cend(),
-        [this](const std::pair<std::shared_ptr<Variable>, bool> &p) {
-          return isUnassigned(p) && p.first != variables[watch1].first;
-        })};
-    if (it != variables.cend()) {
-      watch0 = std::distance(variables.cbegin(), it);
-    }
-  }
-  if (isUnsatisfied(variables[watch1])) {
-    auto it{std::find_if(
-        variables.cbegin(), variables.cend(),
-        [this](const std::pair<std::shared_ptr<Variable>, bool> &p) {
-          return isUnassigned(p) && p.first != variables[watch0].first;
-        })};
-    if (it != variables.cend()) {
-      watch1 = std::distance(variables.cbegin(), it);
-    }
-  }
+bool cdclsolve::Clause::isUnsatisfied(const VariableStore &variables) const {
+  return std::all_of(begin(), end(), [&variables](std::int32_t l) {
+    return variables.isFalse(l);
+  });
 }
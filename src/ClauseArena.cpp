@@ -0,0 +1,87 @@
+#include <cdclsolve/ClauseArena.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+thread_local std::vector<std::int32_t> cdclsolve::ClauseArena::spareMemory;
+
+cdclsolve::ClauseArena::ClauseArena() { memory.swap(spareMemory); }
+
+cdclsolve::ClauseArena::ClauseArena(const ClauseArena &other)
+    : ClauseArena{} {
+  memory = other.memory;
+  wasted = other.wasted;
+}
+
+cdclsolve::ClauseArena::ClauseArena(ClauseArena &&other) noexcept
+    : memory{std::move(other.memory)}, wasted{other.wasted} {}
+
+cdclsolve::ClauseArena::~ClauseArena() {
+  if (memory.capacity() > spareMemory.capacity()) {
+    memory.clear();
+    spareMemory.swap(memory);
+  }
+}
+
+cdclsolve::ClauseArena &
+cdclsolve::ClauseArena::operator=(const ClauseArena &other) {
+  memory = other.memory;
+  wasted = other.wasted;
+  return *this;
+}
+
+cdclsolve::ClauseArena &
+cdclsolve::ClauseArena::operator=(ClauseArena &&other) noexcept {
+  memory.swap(other.memory);
+  std::swap(wasted, other.wasted);
+  return *this;
+}
+
+cdclsolve::ClauseReference
+cdclsolve::ClauseArena::add(const std::vector<std::int32_t> &literals,
+                            bool isLearned) {
+  const auto reference{memory.size()};
+  if (reference + Clause::HEADER_SIZE + literals.size() >= NO_CLAUSE) {
+    throw std::runtime_error("clause arena exhausted: more than " +
+                             std::to_string(NO_CLAUSE) + " words");
+  }
+  memory.push_back(static_cast<std::int32_t>(literals.size()));
+  memory.push_back(isLearned ? Clause::FLAG_LEARNED : 0);
+  memory.push_back(0);
+  memory.insert(memory.end(), literals.cbegin(), literals.cend());
+  (*this)[static_cast<ClauseReference>(reference)].setActivity(0.0f);
+  return static_cast<ClauseReference>(reference);
+}
+
+void cdclsolve::ClauseArena::remove(ClauseReference reference) {
+  auto clause{(*this)[reference]};
+  clause.setFlag(Clause::FLAG_DELETED, true);
+  wasted += Clause::HEADER_SIZE + clause.size();
+}
+
+cdclsolve::ClauseReference
+cdclsolve::ClauseArena::relocate(ClauseReference reference, ClauseArena &to) {
+  auto clause{(*this)[reference]};
+  if (clause.hasFlag(Clause::FLAG_RELOCATED)) {
+    return clause.getRelocation();
+  }
+  const auto relocation{static_cast<ClauseReference>(to.memory.size())};
+  to.memory.insert(to.memory.end(), memory.cbegin() + reference,
+                   memory.cbegin() + reference + Clause::HEADER_SIZE +
+                       clause.size());
+  clause.setRelocation(relocation);
+  return relocation;
+}
+
+void cdclsolve::ClauseArena::reserve(std::size_t size) {
+  memory.reserve(size);
+}
+
+std::size_t cdclsolve::ClauseArena::getMemorySize() const {
+  return memory.size() * sizeof(std::int32_t);
+}
+
+std::size_t cdclsolve::ClauseArena::getWastedSize() const {
+  return wasted * sizeof(std::int32_t);
+}
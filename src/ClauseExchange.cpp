@@ -0,0 +1,118 @@
+#include <cdclsolve/ClauseExchange.hpp>
+
+#include <stdexcept>
+#include <string>
+
+cdclsolve::ClauseExchange::ClauseExchange(std::size_t numberOfThreads,
+                                          std::size_t maxSize,
+                                          std::int32_t maxLbd)
+    : maxSize{maxSize}, maxLbd{maxLbd}, channels(numberOfThreads),
+      importers(numberOfThreads) {
+  if (maxSize > MAX_CLAUSE_SIZE) {
+    throw std::invalid_argument("shared clause size must be at most " +
+                                std::to_string(MAX_CLAUSE_SIZE));
+  }
+  for (auto &importer : importers) {
+    importer.cursors.assign(numberOfThreads, 0);
+    importer.filter.assign(FILTER_SIZE, 0);
+  }
+}
+
+bool cdclsolve::ClauseExchange::exportClause(std::size_t thread,
+                                             const std::int32_t *begin,
+                                             const std::int32_t *end,
+                                             std::int32_t lbd) {
+  const auto size{static_cast<std::size_t>(end - begin)};
+  if (size == 0 || size > maxSize || lbd > maxLbd ||
+      isDuplicate(importers[thread], hash(begin, end))) {
+    return false;
+  }
+  auto &channel{channels[thread]};
+  const auto position{channel.head.load(std::memory_order_relaxed)};
+  auto &slot{channel.slots[position % CAPACITY]};
+  slot.sequence.store(2 * position + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot.size.store(static_cast<std::int32_t>(size), std::memory_order_relaxed);
+  slot.lbd.store(lbd, std::memory_order_relaxed);
+  for (std::size_t i{0}; i < size; ++i) {
+    slot.literals[i].store(begin[i], std::memory_order_relaxed);
+  }
+  slot.sequence.store(2 * position + 2, std::memory_order_release);
+  channel.head.store(position + 1, std::memory_order_release);
+  return true;
+}
+
+bool cdclsolve::ClauseExchange::importClause(
+    std::size_t thread, std::vector<std::int32_t> &literals,
+    std::int32_t &lbd) {
+  auto &importer{importers[thread]};
+  for (std::size_t i{0}; i < channels.size(); ++i) {
+    const auto c{importer.channel};
+    if (c == thread) {
+      importer.channel = (c + 1) % channels.size();
+      continue;
+    }
+    const auto &channel{channels[c]};
+    const auto head{channel.head.load(std::memory_order_acquire)};
+    auto &cursor{importer.cursors[c]};
+    if (head - cursor > CAPACITY) {
+      cursor = head - CAPACITY;
+    }
+    while (cursor < head) {
+      const auto position{cursor++};
+      if (readSlot(channel.slots[position % CAPACITY], position, literals,
+                   lbd) &&
+          !isDuplicate(importer, hash(literals.data(),
+                                      literals.data() + literals.size()))) {
+        return true;
+      }
+    }
+    importer.channel = (c + 1) % channels.size();
+  }
+  return false;
+}
+
+std::uint64_t cdclsolve::ClauseExchange::hash(const std::int32_t *begin,
+                                              const std::int32_t *end) {
+  std::uint64_t sum{0};
+  for (auto l{begin}; l != end; ++l) {
+    auto x{static_cast<std::uint64_t>(static_cast<std::uint32_t>(*l)) +
+           0x9e3779b97f4a7c15ULL};
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    sum += x ^ (x >> 31);
+  }
+  return sum | 1;
+}
+
+bool cdclsolve::ClauseExchange::isDuplicate(Importer &importer,
+                                            std::uint64_t clauseHash) {
+  auto &entry{importer.filter[clauseHash % FILTER_SIZE]};
+  if (entry == clauseHash) {
+    return true;
+  }
+  entry = clauseHash;
+  return false;
+}
+
+bool cdclsolve::ClauseExchange::readSlot(const Slot &slot,
+                                         std::uint64_t position,
+                                         std::vector<std::int32_t> &literals,
+                                         std::int32_t &lbd) const {
+  const auto sequence{slot.sequence.load(std::memory_order_acquire)};
+  if (sequence != 2 * position + 2) {
+    return false;
+  }
+  const auto size{static_cast<std::size_t>(
+      slot.size.load(std::memory_order_relaxed))};
+  if (size > MAX_CLAUSE_SIZE) {
+    return false;
+  }
+  literals.resize(size);
+  for (std::size_t i{0}; i < size; ++i) {
+    literals[i] = slot.literals[i].load(std::memory_order_relaxed);
+  }
+  lbd = slot.lbd.load(std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  return slot.sequence.load(std::memory_order_relaxed) == sequence;
+}
@@ -0,0 +1,225 @@
+#include <cdclsolve/CubeAndConquer.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+cdclsolve::CubeAndConquer::CubeAndConquer(Formula formula,
+                                          std::size_t numberOfWorkers,
+                                          std::size_t cubeDepth,
+                                          const std::string &decisionHeuristic,
+                                          const std::string &restartStrategy)
+    : cubeDepth{cubeDepth}, deques(numberOfWorkers), winner{numberOfWorkers} {
+  if (numberOfWorkers == 0) {
+    throw std::invalid_argument("cube and conquer needs at least one worker");
+  }
+  if (formula.hasProofWriter()) {
+    throw std::logic_error("proofs are not supported in cube mode");
+  }
+  formulas.reserve(numberOfWorkers);
+  formulas.push_back(std::move(formula));
+  for (std::size_t i{1}; i < numberOfWorkers; ++i) {
+    formulas.push_back(formulas.front());
+  }
+  for (auto &f : formulas) {
+    solvers.push_back(
+        std::make_unique<Solver>(f, decisionHeuristic, restartStrategy));
+  }
+}
+
+cdclsolve::Solver::Result cdclsolve::CubeAndConquer::solve() {
+  std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+  budgetDeadline = start + budget.time;
+  budgetConflicts.store(budget.conflicts);
+  budgetPropagations.store(budget.propagations);
+  auto &formula{formulas.front()};
+  formula.propagateUnitLiterals(0);
+  if (!formula.hasConflict()) {
+    generateCubes(formula);
+  }
+  formula.restart();
+  durationLookahead = std::chrono::steady_clock::now() - start;
+  for (std::size_t i{0}; i < cubes.size(); ++i) {
+    deques[i % deques.size()].push(i);
+  }
+  std::vector<std::thread> threads;
+  for (std::size_t i{0}; i < solvers.size(); ++i) {
+    threads.emplace_back([this, i] { work(i); });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  if (winner.load() < solvers.size()) {
+    return cubes[winningCube].result;
+  }
+  for (const auto &c : cubes) {
+    if (c.result != Solver::Result::UNSAT) {
+      return Solver::Result::UNKNOWN;
+    }
+  }
+  return Solver::Result::UNSAT;
+}
+
+void cdclsolve::CubeAndConquer::interrupt() {
+  isInterrupted.store(true);
+  for (const auto &solver : solvers) {
+    solver->interrupt();
+  }
+}
+
+void cdclsolve::CubeAndConquer::setBudget(const Solver::Budget &budget) {
+  this->budget = budget;
+}
+
+void cdclsolve::CubeAndConquer::enableStatistics() {
+  for (const auto &solver : solvers) {
+    solver->enableStatistics();
+  }
+}
+
+void cdclsolve::CubeAndConquer::setReporter(const Reporter &reporter,
+                                            std::uint64_t conflictInterval) {
+  for (std::size_t i{0}; i < solvers.size(); ++i) {
+    solvers[i]->setReporter(
+        [reporter, i](const Solver &solver, Solver::Report report) {
+          reporter(i, solver, report);
+        },
+        conflictInterval);
+  }
+}
+
+void cdclsolve::CubeAndConquer::requestReport(Solver::Report report) {
+  for (const auto &solver : solvers) {
+    solver->requestReport(report);
+  }
+}
+
+const cdclsolve::Formula &cdclsolve::CubeAndConquer::getFormula() const {
+  return formulas[getWinner()];
+}
+
+const cdclsolve::Solver &cdclsolve::CubeAndConquer::getSolver() const {
+  return *solvers[getWinner()];
+}
+
+const std::vector<cdclsolve::CubeAndConquer::Cube> &
+cdclsolve::CubeAndConquer::getCubes() const {
+  return cubes;
+}
+
+std::chrono::steady_clock::duration
+cdclsolve::CubeAndConquer::getDurationLookahead() const {
+  return durationLookahead;
+}
+
+void cdclsolve::CubeAndConquer::generateCubes(Formula &formula) {
+  if (cube.size() == cubeDepth || !formula.hasFreeLiterals()) {
+    cubes.push_back({cube});
+    return;
+  }
+  const auto literal{formula.decideLookahead()};
+  const auto decisionLevel{static_cast<std::int32_t>(cube.size())};
+  for (const auto l : {literal, -literal}) {
+    formula.assign(l, decisionLevel + 1);
+    formula.propagateUnitLiterals(decisionLevel + 1);
+    if (!formula.hasConflict()) {
+      cube.push_back(l);
+      generateCubes(formula);
+      cube.pop_back();
+    }
+    formula.cancel(decisionLevel);
+  }
+}
+
+void cdclsolve::CubeAndConquer::work(std::size_t worker) {
+  std::size_t index{0};
+  while (winner.load() == solvers.size() && !isInterrupted.load() &&
+         !isBudgetExhausted() && takeCube(worker, index)) {
+    auto &c{cubes[index]};
+    std::chrono::steady_clock::time_point start{
+        std::chrono::steady_clock::now()};
+    c.result = solveCube(worker, c.literals);
+    c.duration = std::chrono::steady_clock::now() - start;
+    c.worker = worker;
+    auto expected{solvers.size()};
+    if ((c.result == Solver::Result::SAT ||
+         (c.result == Solver::Result::UNSAT &&
+          formulas[worker].hasConflict())) &&
+        winner.compare_exchange_strong(expected, worker)) {
+      winningCube = index;
+      interrupt();
+    }
+  }
+}
+
+cdclsolve::Solver::Result cdclsolve::CubeAndConquer::solveCube(
+    std::size_t worker, const std::vector<std::int32_t> &literals) {
+  auto &formula{formulas[worker]};
+  auto result{Solver::Result::UNKNOWN};
+  while (result == Solver::Result::UNKNOWN &&
+         winner.load() == solvers.size() && !isInterrupted.load() &&
+         !isBudgetExhausted()) {
+    auto cubeBudget{budget};
+    cubeBudget.conflicts = reserveBudget(budgetConflicts);
+    cubeBudget.propagations = reserveBudget(budgetPropagations);
+    if (budget.time != std::chrono::steady_clock::duration::zero()) {
+      cubeBudget.time = std::max(
+          budgetDeadline - std::chrono::steady_clock::now(),
+          std::chrono::steady_clock::duration{1});
+    }
+    const auto conflicts{formula.getConflicts()};
+    const auto propagations{formula.getPropagations()};
+    if ((budget.conflicts == 0 || cubeBudget.conflicts != 0) &&
+        (budget.propagations == 0 || cubeBudget.propagations != 0)) {
+      solvers[worker]->setBudget(cubeBudget);
+      result = solvers[worker]->solve(literals);
+    }
+    budgetConflicts.fetch_add(
+        cubeBudget.conflicts -
+        std::min(cubeBudget.conflicts, formula.getConflicts() - conflicts));
+    budgetPropagations.fetch_add(
+        cubeBudget.propagations -
+        std::min(cubeBudget.propagations,
+                 formula.getPropagations() - propagations));
+  }
+  return result;
+}
+
+bool cdclsolve::CubeAndConquer::isBudgetExhausted() const {
+  return (budget.conflicts != 0 && budgetConflicts.load() == 0) ||
+         (budget.propagations != 0 && budgetPropagations.load() == 0) ||
+         (budget.time != std::chrono::steady_clock::duration::zero() &&
+          std::chrono::steady_clock::now() >= budgetDeadline);
+}
+
+std::uint64_t cdclsolve::CubeAndConquer::reserveBudget(
+    std::atomic<std::uint64_t> &remaining) const {
+  auto available{remaining.load()};
+  std::uint64_t amount{0};
+  do {
+    if (available == 0) {
+      return 0;
+    }
+    amount = std::max<std::uint64_t>(1, available / solvers.size());
+  } while (!remaining.compare_exchange_weak(available, available - amount));
+  return amount;
+}
+
+bool cdclsolve::CubeAndConquer::takeCube(std::size_t worker,
+                                         std::size_t &index) {
+  if (deques[worker].pop(index)) {
+    return true;
+  }
+  for (std::size_t i{1}; i < deques.size(); ++i) {
+    if (deques[(worker + i) % deques.size()].steal(index)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::size_t cdclsolve::CubeAndConquer::getWinner() const {
+  const auto index{winner.load()};
+  return index < solvers.size() ? index : 0;
+}
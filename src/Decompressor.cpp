@@ -0,0 +1,222 @@
+#include <cdclsolve/Decompressor.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include <bzlib.h>
+#include <lzma.h>
+#include <zlib.h>
+
+cdclsolve::Decompressor::Format
+cdclsolve::Decompressor::detectFormat(const char *begin, const char *end) {
+  const auto startsWith{[begin, end](const char *magic, std::size_t size) {
+    return static_cast<std::size_t>(end - begin) >= size &&
+           std::memcmp(begin, magic, size) == 0;
+  }};
+  if (startsWith("\x1f\x8b", 2)) {
+    return Format::GZIP;
+  }
+  if (startsWith("\xfd\x37\x7a\x58\x5a\x00", 6)) {
+    return Format::XZ;
+  }
+  if (startsWith("BZh", 3)) {
+    return Format::BZIP2;
+  }
+  return Format::NONE;
+}
+
+cdclsolve::Decompressor::Decompressor(const char *begin, const char *end,
+                                      Format format)
+    : begin{begin}, end{end}, worker{&Decompressor::run, this, format} {}
+
+cdclsolve::Decompressor::~Decompressor() {
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    isStopped = true;
+  }
+  blockRemoved.notify_one();
+  worker.join();
+}
+
+std::size_t cdclsolve::Decompressor::read(char *data, std::size_t size) {
+  if (blockPosition == block.size()) {
+    std::unique_lock<std::mutex> lock{mutex};
+    blockAdded.wait(lock, [this] { return !blocks.empty() || isFinished; });
+    if (blocks.empty()) {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+      return 0;
+    }
+    block = std::move(blocks.front());
+    blocks.pop_front();
+    blockPosition = 0;
+    lock.unlock();
+    blockRemoved.notify_one();
+  }
+  const auto count{std::min(size, block.size() - blockPosition)};
+  std::memcpy(data, block.data() + blockPosition, count);
+  blockPosition += count;
+  return count;
+}
+
+void cdclsolve::Decompressor::run(Format format) {
+  try {
+    switch (format) {
+    case Format::GZIP:
+      inflateGzip();
+      break;
+    case Format::XZ:
+      decompressXz();
+      break;
+    case Format::BZIP2:
+      decompressBzip2();
+      break;
+    case Format::NONE:
+      throw std::invalid_argument("input file is not compressed");
+    }
+  } catch (...) {
+    std::lock_guard<std::mutex> lock{mutex};
+    error = std::current_exception();
+  }
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    isFinished = true;
+  }
+  blockAdded.notify_one();
+}
+
+void cdclsolve::Decompressor::inflateGzip() {
+  z_stream stream{};
+  if (inflateInit2(&stream, 15 + 32) != Z_OK) {
+    throw std::runtime_error("cannot initialize gzip decompression");
+  }
+  stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(begin));
+  stream.avail_in = 0;
+  auto remaining{static_cast<std::size_t>(end - begin)};
+  std::vector<char> output(BLOCK_SIZE);
+  int status{Z_OK};
+  do {
+    if (stream.avail_in == 0) {
+      stream.avail_in = static_cast<uInt>(
+          std::min<std::size_t>(remaining, std::numeric_limits<uInt>::max()));
+      remaining -= stream.avail_in;
+    }
+    stream.next_out = reinterpret_cast<Bytef *>(output.data());
+    stream.avail_out = static_cast<uInt>(output.size());
+    status = inflate(&stream, Z_NO_FLUSH);
+    if (status == Z_STREAM_END && (stream.avail_in > 0 || remaining > 0)) {
+      status = inflateReset(&stream);
+    }
+    if (status != Z_OK && status != Z_STREAM_END) {
+      inflateEnd(&stream);
+      throw std::runtime_error("invalid gzip input file");
+    }
+    if (!push(output, output.size() - stream.avail_out)) {
+      break;
+    }
+    if (status == Z_OK && stream.avail_in == 0 && remaining == 0 &&
+        stream.avail_out != 0) {
+      inflateEnd(&stream);
+      throw std::runtime_error("unexpected end of gzip input file");
+    }
+  } while (status != Z_STREAM_END);
+  inflateEnd(&stream);
+}
+
+void cdclsolve::Decompressor::decompressXz() {
+  lzma_stream stream = LZMA_STREAM_INIT;
+  if (lzma_stream_decoder(&stream, UINT64_MAX, LZMA_CONCATENATED) !=
+      LZMA_OK) {
+    throw std::runtime_error("cannot initialize xz decompression");
+  }
+  stream.next_in = reinterpret_cast<const std::uint8_t *>(begin);
+  stream.avail_in = static_cast<std::size_t>(end - begin);
+  std::vector<char> output(BLOCK_SIZE);
+  lzma_ret status{LZMA_OK};
+  do {
+    stream.next_out = reinterpret_cast<std::uint8_t *>(output.data());
+    stream.avail_out = output.size();
+    status = lzma_code(&stream, LZMA_FINISH);
+    if (status == LZMA_BUF_ERROR) {
+      lzma_end(&stream);
+      throw std::runtime_error("unexpected end of xz input file");
+    }
+    if (status != LZMA_OK && status != LZMA_STREAM_END) {
+      lzma_end(&stream);
+      throw std::runtime_error("invalid xz input file");
+    }
+    if (!push(output, output.size() - stream.avail_out)) {
+      break;
+    }
+  } while (status != LZMA_STREAM_END);
+  lzma_end(&stream);
+}
+
+void cdclsolve::Decompressor::decompressBzip2() {
+  bz_stream stream{};
+  if (BZ2_bzDecompressInit(&stream, 0, 0) != BZ_OK) {
+    throw std::runtime_error("cannot initialize bzip2 decompression");
+  }
+  stream.next_in = const_cast<char *>(begin);
+  stream.avail_in = 0;
+  auto remaining{static_cast<std::size_t>(end - begin)};
+  std::vector<char> output(BLOCK_SIZE);
+  int status{BZ_OK};
+  do {
+    if (stream.avail_in == 0) {
+      stream.avail_in = static_cast<unsigned int>(std::min<std::size_t>(
+          remaining, std::numeric_limits<unsigned int>::max()));
+      remaining -= stream.avail_in;
+    }
+    stream.next_out = output.data();
+    stream.avail_out = static_cast<unsigned int>(output.size());
+    status = BZ2_bzDecompress(&stream);
+    if (status == BZ_STREAM_END && (stream.avail_in > 0 || remaining > 0)) {
+      const auto nextIn{stream.next_in};
+      const auto availIn{stream.avail_in};
+      BZ2_bzDecompressEnd(&stream);
+      status = BZ2_bzDecompressInit(&stream, 0, 0);
+      stream.next_in = nextIn;
+      stream.avail_in = availIn;
+    }
+    if (status != BZ_OK && status != BZ_STREAM_END) {
+      BZ2_bzDecompressEnd(&stream);
+      throw std::runtime_error("invalid bzip2 input file");
+    }
+    if (!push(output, output.size() - stream.avail_out)) {
+      break;
+    }
+    if (status == BZ_OK && stream.avail_in == 0 && remaining == 0 &&
+        stream.avail_out != 0) {
+      BZ2_bzDecompressEnd(&stream);
+      throw std::runtime_error("unexpected end of bzip2 input file");
+    }
+  } while (status != BZ_STREAM_END);
+  BZ2_bzDecompressEnd(&stream);
+}
+
+bool cdclsolve::Decompressor::push(std::vector<char> &output,
+                                   std::size_t size) {
+  if (size == 0) {
+    return true;
+  }
+  std::vector<char> next(output.size());
+  output.resize(size);
+  {
+    std::unique_lock<std::mutex> lock{mutex};
+    blockRemoved.wait(
+        lock, [this] { return blocks.size() < MAX_BLOCKS || isStopped; });
+    if (isStopped) {
+      return false;
+    }
+    blocks.push_back(std::move(output));
+  }
+  blockAdded.notify_one();
+  output = std::move(next);
+  return true;
+}
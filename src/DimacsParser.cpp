@@ -0,0 +1,145 @@
+#include <cdclsolve/DimacsParser.hpp>
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+const char *cdclsolve::DimacsParser::parseHeader(const char *begin,
+                                                 const char *end) {
+  auto p{skipBlanks(begin, end)};
+  while (p != end && (*p == COMMENT_LINE_C || *p == '\n')) {
+    p = skipBlanks(*p == '\n' ? p + 1 : skipLine(p, end), end);
+  }
+  if (p == end) {
+    return end;
+  }
+  auto tokenEnd{findTokenEnd(p, end)};
+  if (std::string_view(p, tokenEnd - p) != PROBLEM_LINE_P) {
+    throw std::runtime_error("invalid token in problem line: expected '" +
+                             std::string(PROBLEM_LINE_P) + "' but got '" +
+                             std::string(p, tokenEnd) + "'");
+  }
+  p = skipBlanks(tokenEnd, end);
+  tokenEnd = findTokenEnd(p, end);
+  if (std::string_view(p, tokenEnd - p) != PROBLEM_LINE_CNF) {
+    throw std::runtime_error("invalid token in problem line: expected '" +
+                             std::string(PROBLEM_LINE_CNF) + "' but got '" +
+                             std::string(p, tokenEnd) + "'");
+  }
+  p = skipBlanks(tokenEnd, end);
+  numberOfAtoms = parseCount(p, end);
+  p = skipBlanks(p, end);
+  numberOfClauses = parseCount(p, end);
+  isHeaderParsed = true;
+  return skipLine(p, end);
+}
+
+void cdclsolve::DimacsParser::parseClauses(const char *begin,
+                                           const char *end) {
+  auto p{begin};
+  while (true) {
+    p = skipBlanks(p, end);
+    if (p == end) {
+      return;
+    }
+    if (*p == '\n') {
+      ++p;
+      continue;
+    }
+    if (*p == COMMENT_LINE_C) {
+      p = skipLine(p, end);
+      continue;
+    }
+    const auto tokenBegin{p};
+    const bool isNegative{*p == '-'};
+    if (isNegative) {
+      ++p;
+    }
+    std::int64_t atom{0};
+    const auto digitsBegin{p};
+    while (p != end && *p >= '0' && *p <= '9') {
+      atom = 10 * atom + (*p - '0');
+      if (atom > numberOfAtoms) {
+        throw std::runtime_error(
+            "unexpected literal in matrix line: expected " +
+            std::to_string(numberOfAtoms) + " distinct atoms but got literal " +
+            std::string(tokenBegin, findTokenEnd(tokenBegin, end)));
+      }
+      ++p;
+    }
+    if (p == digitsBegin || (p != end && !isBlank(*p) && *p != '\n')) {
+      throw std::runtime_error(
+          "invalid token in matrix line: '" +
+          std::string(tokenBegin, findTokenEnd(tokenBegin, end)) + "'");
+    }
+    const auto literal{static_cast<std::int32_t>(atom)};
+    literals.push_back(isNegative ? -literal : literal);
+  }
+}
+
+bool cdclsolve::DimacsParser::hasHeader() const { return isHeaderParsed; }
+
+std::int32_t cdclsolve::DimacsParser::getNumberOfAtoms() const {
+  return numberOfAtoms;
+}
+
+std::int32_t cdclsolve::DimacsParser::getNumberOfClauses() const {
+  return numberOfClauses;
+}
+
+std::size_t cdclsolve::DimacsParser::getSize() const {
+  return literals.size();
+}
+
+std::vector<std::int32_t> cdclsolve::DimacsParser::takeLiterals() {
+  return std::exchange(literals, {});
+}
+
+bool cdclsolve::DimacsParser::isBlank(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+const char *cdclsolve::DimacsParser::skipBlanks(const char *begin,
+                                                const char *end) {
+  while (begin != end && isBlank(*begin)) {
+    ++begin;
+  }
+  return begin;
+}
+
+const char *cdclsolve::DimacsParser::skipLine(const char *begin,
+                                              const char *end) {
+  const auto newline{static_cast<const char *>(
+      std::memchr(begin, '\n', static_cast<std::size_t>(end - begin)))};
+  return newline == nullptr ? end : newline + 1;
+}
+
+const char *cdclsolve::DimacsParser::findTokenEnd(const char *begin,
+                                                  const char *end) {
+  while (begin != end && !isBlank(*begin) && *begin != '\n') {
+    ++begin;
+  }
+  return begin;
+}
+
+std::int32_t cdclsolve::DimacsParser::parseCount(const char *&begin,
+                                                 const char *end) {
+  const auto tokenEnd{findTokenEnd(begin, end)};
+  std::int64_t count{0};
+  for (auto p{begin}; p != tokenEnd; ++p) {
+    if (*p < '0' || *p > '9' ||
+        (count = 10 * count + (*p - '0')) >
+            std::numeric_limits<std::int32_t>::max()) {
+      count = -1;
+      break;
+    }
+  }
+  if (begin == tokenEnd || count < 0) {
+    throw std::runtime_error("invalid number in problem line: '" +
+                             std::string(begin, tokenEnd) + "'");
+  }
+  begin = tokenEnd;
+  return static_cast<std::int32_t>(count);
+}
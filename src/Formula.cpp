@@ -1,369 +1,1184 @@
 #include <cdclsolve/Formula.hpp>
 
+#include <cdclsolve/Decompressor.hpp>
+#include <cdclsolve/MappedFile.hpp>
+#include <cdclsolve/Preprocessor.hpp>
+#include <cdclsolve/ProofWriter.hpp>
+
 #include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <functional>
+#include <future>
+#include <limits>
+#include <random>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
+
+cdclsolve::Formula::Formula() : Formula{0, 0} {}
 
 cdclsolve::Formula cdclsolve::Formula::readInput(std::istream &from) {
-  std::int32_t numberOfAtoms;
-  std::int32_t numberOfClauses;
-  std::string token;
-  std::int32_t atom;
-  from >> token;
-  while (token == std::string(COMMENT_LINE_C)) {
-    std::string commentLine{};
-    std::getline(from, commentLine);
-    from >> token;
-  }
-  if (token != std::string(PROBLEM_LINE_P)) {
-    throw std::runtime_error("invalid token in problem line: expected '" +
-                             std::string(PROBLEM_LINE_P) + "' but got '" +
-                             token + "'");
-  }
-  from >> token;
-  if (token != std::string(PROBLEM_LINE_CNF)) {
-    throw std::runtime_error("invalid token in problem line: expected '" +
-                             std::string(PROBLEM_LINE_CNF) + "' but got '" +
-                             token + "'");
-  }
-  from >> numberOfAtoms;
-  from >> numberOfClauses;
-  from >> token;
-  while (token == std::string(COMMENT_LINE_C)) {
-    std::getline(from, token);
-    from >> token;
+  return readBlocks([&from](char *data, std::size_t size) {
+    from.read(data, static_cast<std::streamsize>(size));
+    return static_cast<std::size_t>(from.gcount());
+  });
+}
+
+cdclsolve::Formula
+cdclsolve::Formula::readInput(const std::string &fileName) {
+  const MappedFile file{fileName};
+  if (file.size() >= BINARY_MAGIC.size() &&
+      std::string_view(file.begin(), BINARY_MAGIC.size()) == BINARY_MAGIC) {
+    return readBinary(file.begin(), file.end());
   }
-  Formula formula{numberOfAtoms, numberOfClauses};
-  while (!from.eof()) {
-    std::vector<std::pair<std::shared_ptr<Variable>, bool>> clause;
-    while (token != "0") {
-      atom = std::stoi(token);
-      if (std::abs(atom) > numberOfAtoms) {
-        throw std::runtime_error(
-            "unexpected literal in matrix line: expected " +
-            std::to_string(numberOfAtoms) + " distinct atoms but got literal " +
-            std::to_string(atom));
-      }
-      clause.push_back({formula.variables[std::abs(atom)], atom > 0});
-      from >> token;
+  if (const auto format{
+          Decompressor::detectFormat(file.begin(), file.end())};
+      format != Decompressor::Format::NONE) {
+    Decompressor decompressor{file.begin(), file.end(), format};
+    return readBlocks([&decompressor](char *data, std::size_t size) {
+      return decompressor.read(data, size);
+    });
+  }
+  std::vector<DimacsParser> parsers(1);
+  const auto begin{parsers.front().parseHeader(file.begin(), file.end())};
+  const auto size{static_cast<std::size_t>(file.end() - begin)};
+  const auto numberOfChunks{std::clamp<std::size_t>(
+      size / MIN_CHUNK_SIZE, 1,
+      std::max(std::thread::hardware_concurrency(), 1u))};
+  std::vector<const char *> bounds{begin};
+  for (std::size_t i{1}; i < numberOfChunks; ++i) {
+    auto bound{std::max(bounds.back(), begin + i * (size / numberOfChunks))};
+    while (bound != file.end() && *bound++ != '\n') {
     }
-    if (from.eof()) {
-      throw std::runtime_error("unexpected end of file while parsing clause");
+    bounds.push_back(bound);
+  }
+  bounds.push_back(file.end());
+  parsers.resize(numberOfChunks, parsers.front());
+  std::vector<std::future<void>> futures;
+  for (std::size_t i{1}; i < numberOfChunks; ++i) {
+    futures.push_back(std::async(std::launch::async, [&parsers, &bounds, i] {
+      parsers[i].parseClauses(bounds[i], bounds[i + 1]);
+    }));
+  }
+  if (parsers.front().hasHeader()) {
+    parsers.front().parseClauses(bounds[0], bounds[1]);
+  }
+  for (auto &future : futures) {
+    future.get();
+  }
+  return readClauses(parsers);
+}
+
+const cdclsolve::VariableStore &cdclsolve::Formula::getVariables() const {
+  return variables;
+}
+
+std::int32_t cdclsolve::Formula::getNumberOfClauses() const {
+  return numberOfClauses;
+}
+
+void cdclsolve::Formula::addClause(std::vector<std::int32_t> literals) {
+  backtrack(0);
+  std::sort(literals.begin(), literals.end());
+  literals.erase(std::unique(literals.begin(), literals.end()), literals.end());
+  std::int32_t numberOfAtoms{0};
+  for (const auto l : literals) {
+    if (l == 0 || l == std::numeric_limits<std::int32_t>::min()) {
+      throw std::invalid_argument("invalid literal in clause: " +
+                                  std::to_string(l));
     }
-    formula.addClause(std::make_shared<Clause>(clause));
-    from >> token;
+    if (isEliminated(std::abs(l))) {
+      throw std::logic_error("clause contains eliminated variable: " +
+                             std::to_string(l));
+    }
+    numberOfAtoms = std::max(numberOfAtoms, std::abs(l));
   }
-  if (formula.clauses.size() != numberOfClauses) {
-    throw std::runtime_error(
-        "invalid number of clauses: expected " +
-        std::to_string(numberOfClauses) + " clauses but parsed " +
-        std::to_string(formula.clauses.size()) + " clauses");
+  addVariables(numberOfAtoms);
+  if (std::any_of(literals.begin(), literals.end(),
+                  [&literals](std::int32_t l) {
+                    return std::binary_search(literals.begin(),
+                                              literals.end(), -l);
+                  })) {
+    return;
+  }
+  ++numberOfClauses;
+  if (hasConflict() ||
+      std::any_of(literals.begin(), literals.end(),
+                  [this](std::int32_t l) { return variables.isTrue(l); })) {
+    return;
+  }
+  const auto kept{static_cast<std::size_t>(
+      std::stable_partition(
+          literals.begin(), literals.end(),
+          [this](std::int32_t l) { return !variables.isFalse(l); }) -
+      literals.begin())};
+  const auto reference{addClause(literals, false)};
+  if (proofWriter != nullptr && proofWriter->hasHints()) {
+    clauseIds.emplace(reference, nextClauseId++);
+  }
+  if (kept == 0) {
+    conflict = reference;
+  } else if (kept == 1) {
+    assign(literals[0], reference, 0);
   }
-  return formula;
 }
 
-void cdclsolve::Formula::writeOutput(const Formula &formula, std::ostream &to) {
-  to << SOLUTION_LINE_S << " " << SOLUTION_LINE_CNF << " "
-     << formula.getAnswer() << " " << formula.variables.size() - 1 << " "
-     << formula.numberOfClauses << std::endl;
-  if (formula.isSatisfied()) {
-    for (const auto &v : formula.variables) {
-      if (v->getValue() != 0 && v->isAssigned()) {
-        to << CERT_LINE_V << " "
-           << (v->isTrue() ? v->getValue() : -v->getValue()) << std::endl;
+void cdclsolve::Formula::addVariables(std::int32_t numberOfAtoms) {
+  const auto previous{variables.getNumberOfVariables()};
+  if (numberOfAtoms <= previous) {
+    return;
+  }
+  const auto size{2 * static_cast<std::size_t>(numberOfAtoms) + 2};
+  variables.resize(numberOfAtoms);
+  watches.resize(size);
+  occurrences.resize(size);
+  seen.resize(static_cast<std::size_t>(numberOfAtoms) + 1, 0);
+  levelStamps.resize(static_cast<std::size_t>(numberOfAtoms) + 1, 0);
+  vsidsQueue.resize(numberOfAtoms);
+  jeroslowWangQueue.resize(size);
+  dlisQueue.resize(size);
+  for (auto v{previous + 1}; v <= numberOfAtoms; ++v) {
+    for (const auto l : {v, -v}) {
+      if (isJeroslowWangQueueActive) {
+        jeroslowWangQueue.insert(VariableStore::getLiteralIndex(l));
+      }
+      if (isDlisQueueActive) {
+        dlisQueue.insert(VariableStore::getLiteralIndex(l));
       }
     }
   }
 }
 
-bool cdclsolve::Formula::hasFreeLiterals() const {
-  for (const auto &v : variables) {
-    if (!v->isAssigned()) {
-      return true;
+void cdclsolve::Formula::preprocess() {
+  backtrack(0);
+  if (isPreprocessed || hasConflict() || !learnedClauses.empty()) {
+    return;
+  }
+  isPreprocessed = true;
+  Preprocessor preprocessor{variables.getNumberOfVariables(), proofWriter,
+                            nextClauseId};
+  preprocessor.reserve(clauses.size(),
+                       clauseArena.getMemorySize() / sizeof(std::int32_t));
+  for (const auto c : clauses) {
+    const auto clause{clauseArena[c]};
+    const auto entry{clauseIds.find(c)};
+    preprocessor.addClause(clause.begin(), clause.end(),
+                           entry == clauseIds.end() ? 0 : entry->second);
+  }
+  preprocessor.preprocess();
+  for (const auto l : trail) {
+    variables.unassign(std::abs(l));
+    vsidsQueue.insert(std::abs(l));
+  }
+  trail.clear();
+  propagationHead = 0;
+  for (auto &watchList : watches) {
+    watchList.clear();
+  }
+  for (auto &occurrenceList : occurrences) {
+    occurrenceList.clear();
+  }
+  clauses.clear();
+  clauseIds.clear();
+  clauseArena = ClauseArena{};
+  conflict = ClauseArena::NO_CLAUSE;
+  std::vector<std::int32_t> literals;
+  for (const auto &clause : preprocessor.getClauses()) {
+    if (clause.isDeleted) {
+      continue;
     }
+    literals.assign(preprocessor.begin(clause), preprocessor.end(clause));
+    const auto reference{addClause(literals, false)};
+    if (proofWriter != nullptr && proofWriter->hasHints()) {
+      clauseIds.emplace(reference, clause.id);
+    }
+  }
+  nextClauseId = preprocessor.getNextClauseId();
+  eliminated.resize(static_cast<std::size_t>(variables.getNumberOfVariables()) +
+                    1);
+  for (const auto v : preprocessor.getEliminatedVariables()) {
+    assign(-v, ClauseArena::NO_CLAUSE, 0);
+    eliminated[v] = 1;
   }
-  return false;
+  eliminatedVariables = preprocessor.getEliminatedVariables().size();
+  const auto &stack{preprocessor.getReconstructionStack()};
+  reconstructionStack.insert(reconstructionStack.end(), stack.begin(),
+                             stack.end());
+  assignUnitClauses();
+}
+
+void cdclsolve::Formula::reconstructModel() {
+  for (auto end{reconstructionStack.size()}; end > 0;) {
+    const auto size{static_cast<std::size_t>(reconstructionStack[end - 1])};
+    const auto begin{end - 1 - size};
+    if (std::none_of(reconstructionStack.begin() + begin,
+                     reconstructionStack.begin() + end - 1,
+                     [this](std::int32_t l) { return variables.isTrue(l); })) {
+      variables.setValue(reconstructionStack[begin]);
+    }
+    end = begin;
+  }
+  for (std::size_t i{0}; i < eliminatedVariables; ++i) {
+    const auto variable{std::abs(trail[i])};
+    trail[i] = variables.isTrue(variable) ? variable : -variable;
+  }
+}
+
+bool cdclsolve::Formula::isEliminated(std::int32_t variable) const {
+  return static_cast<std::size_t>(variable) < eliminated.size() &&
+         eliminated[variable] != 0;
+}
+
+std::vector<std::int32_t>
+cdclsolve::Formula::analyzeAssumption(std::int32_t literal) {
+  std::vector<std::int32_t> assumptions{literal};
+  const auto variable{std::abs(literal)};
+  if (variables.getDecisionLevel(variable) <= 0) {
+    return assumptions;
+  }
+  seen[variable] = 1;
+  for (auto i{trail.size()}; i > trailLimits.front(); --i) {
+    const auto v{std::abs(trail[i - 1])};
+    if (!seen[v]) {
+      continue;
+    }
+    seen[v] = 0;
+    const auto reason{variables.getReason(v)};
+    if (reason == ClauseArena::NO_CLAUSE) {
+      assumptions.push_back(trail[i - 1]);
+      continue;
+    }
+    for (const auto l : clauseArena[reason]) {
+      if (std::abs(l) != v && variables.getDecisionLevel(std::abs(l)) > 0) {
+        seen[std::abs(l)] = 1;
+      }
+    }
+  }
+  return assumptions;
+}
+
+bool cdclsolve::Formula::hasFreeLiterals() const {
+  return trail.size() <
+         static_cast<std::size_t>(variables.getNumberOfVariables());
 }
 
 void cdclsolve::Formula::propagateUnitLiterals(std::int32_t decisionLevel) {
-  bool hasMoreUnitLiterals{true};
-  while (hasMoreUnitLiterals) {
-    hasMoreUnitLiterals = false;
-    for (const auto &c : clauses) {
-      if (c->isUnsatisfied()) {
-        conflict = std::make_shared<Variable>(0);
-        conflict->assignTrue(c, decisionLevel);
-        return;
-      } else if (c->isUnit()) {
-        auto l{c->getSatisfyingAssignment()};
-        if (!variables.at(std::abs(l))->isAssigned()) {
-          hasMoreUnitLiterals = true;
-          if (l > 0) {
-            assignTrue(l, c, decisionLevel);
-          } else {
-            assignFalse(-l, c, decisionLevel);
-          }
+  while (!hasConflict() && propagationHead < trail.size()) {
+    const auto literal{-trail[propagationHead++]};
+    ++propagations;
+    auto &watchList{watches[VariableStore::getLiteralIndex(literal)]};
+    std::size_t kept{0};
+    for (std::size_t i{0}; i < watchList.size(); ++i) {
+      const auto c{watchList[i]};
+      if (hasConflict()) {
+        watchList[kept++] = c;
+        continue;
+      }
+      auto clause{clauseArena[c]};
+      if (clause[0] == literal) {
+        std::swap(clause[0], clause[1]);
+      }
+      if (variables.isTrue(clause[0])) {
+        watchList[kept++] = c;
+        continue;
+      }
+      bool isMoved{false};
+      for (std::size_t k{2}; k < clause.size(); ++k) {
+        if (!variables.isFalse(clause[k])) {
+          std::swap(clause[1], clause[k]);
+          watches[VariableStore::getLiteralIndex(clause[1])].push_back(c);
+          isMoved = true;
+          break;
         }
       }
+      if (isMoved) {
+        continue;
+      }
+      watchList[kept++] = c;
+      if (variables.isFalse(clause[0])) {
+        conflict = c;
+      } else {
+        assign(clause[0], c, decisionLevel);
+      }
     }
+    watchList.resize(kept);
   }
 }
 
 void cdclsolve::Formula::assign(std::int32_t literal,
                                 std::int32_t decisionLevel) {
-  if (literal > 0) {
-    assignTrue(literal, nullptr, decisionLevel);
-  } else {
-    assignFalse(-literal, nullptr, decisionLevel);
-  }
+  trailLimits.push_back(trail.size());
+  assign(literal, ClauseArena::NO_CLAUSE, decisionLevel);
 }
 
 std::int32_t cdclsolve::Formula::decideBasic() const {
-  const auto it{std::find_if(variables.cbegin(), variables.cend(),
-                             [](const std::shared_ptr<Variable> &v) {
-                               return v->getValue() != 0 && !v->isAssigned();
-                             })};
-  if (it != variables.cend()) {
-    return (*it)->getValue();
+  for (std::int32_t vi{1}; vi <= variables.getNumberOfVariables(); ++vi) {
+    if (!variables.isAssigned(vi)) {
+      return vi;
+    }
   }
   return 0;
 }
 
 std::int32_t cdclsolve::Formula::decideJeroslowWang() const {
-  std::int32_t literal{0};
-  float maxHeuristic{-1.0f};
-  for (std::size_t vi{1}; vi < variables.size(); ++vi) {
-    if (!variables.at(vi)->isAssigned()) {
-      if (auto h{getJeroslowWangHeuristic(vi)}; h > maxHeuristic) {
-        literal = vi;
-        maxHeuristic = h;
-      }
-      if (auto h{getJeroslowWangHeuristic(-vi)}; h > maxHeuristic) {
-        literal = -vi;
-        maxHeuristic = h;
-      }
-    }
+  if (!isJeroslowWangQueueActive) {
+    initializeJeroslowWangQueue();
   }
-  return literal;
+  return decideLiteral(jeroslowWangQueue);
 }
 
 std::int32_t cdclsolve::Formula::decideDlis() const {
-  std::int32_t literal{0};
-  std::int32_t maxSatisfyingClauses{-1};
-  for (std::size_t vi{1}; vi < variables.size(); ++vi) {
-    if (!variables.at(vi)->isAssigned()) {
-      if (auto msc{getSatisfyingClauses(vi)}; msc > maxSatisfyingClauses) {
-        literal = vi;
-        maxSatisfyingClauses = msc;
+  if (!isDlisQueueActive) {
+    initializeDlisQueue();
+  }
+  return decideLiteral(dlisQueue);
+}
+
+std::int32_t cdclsolve::Formula::decideVsids() const {
+  while (!vsidsQueue.isEmpty()) {
+    if (auto v{vsidsQueue.removeMax()}; !variables.isAssigned(v)) {
+      return variables.getSavedLiteral(v);
+    }
+  }
+  return 0;
+}
+
+std::int32_t cdclsolve::Formula::decideLookahead() {
+  std::vector<std::pair<double, std::int32_t>> candidates;
+  for (std::int32_t v{1}; v <= variables.getNumberOfVariables(); ++v) {
+    if (variables.isAssigned(v)) {
+      continue;
+    }
+    double score{0.0};
+    for (const auto l : {v, -v}) {
+      for (const auto c : occurrences[VariableStore::getLiteralIndex(l)]) {
+        const auto clause{clauseArena[c]};
+        if (!clause.hasFlag(Clause::FLAG_DELETED) &&
+            !clause.isSatisfied(variables)) {
+          score += std::ldexp(1.0, -static_cast<int>(clause.size()));
+        }
       }
-      if (auto msc{getSatisfyingClauses(-vi)}; msc > maxSatisfyingClauses) {
-        literal = -vi;
-        maxSatisfyingClauses = msc;
+    }
+    candidates.emplace_back(score, v);
+  }
+  if (candidates.empty()) {
+    return 0;
+  }
+  const auto middle{candidates.begin() +
+                    std::min(candidates.size(), LOOKAHEAD_CANDIDATES)};
+  std::partial_sort(candidates.begin(), middle, candidates.end(),
+                    std::greater<>{});
+  const auto limit{static_cast<std::size_t>(variables.getNumberOfVariables())};
+  std::int32_t best{0};
+  std::size_t bestScore{0};
+  for (auto candidate{candidates.begin()}; candidate != middle; ++candidate) {
+    const auto v{candidate->second};
+    const auto positive{std::min(probe(v), limit)};
+    const auto negative{std::min(probe(-v), limit)};
+    const auto score{(positive + 1) * (negative + 1)};
+    if (best == 0 || score > bestScore) {
+      best = positive >= negative ? v : -v;
+      bestScore = score;
+    }
+  }
+  return best;
+}
+
+void cdclsolve::Formula::addDecisionLevel() {
+  trailLimits.push_back(trail.size());
+}
+
+void cdclsolve::Formula::cancel(std::int32_t decisionLevel) {
+  conflict = ClauseArena::NO_CLAUSE;
+  backtrack(decisionLevel);
+}
+
+bool cdclsolve::Formula::hasConflict() const {
+  return conflict != ClauseArena::NO_CLAUSE;
+}
+
+std::int32_t cdclsolve::Formula::resolveConflict(std::int32_t decisionLevel) {
+  if (decisionLevel == 0) {
+    if (proofWriter != nullptr) {
+      learnedClause.clear();
+      collectProofHints();
+      proofWriter->addClause(nextClauseId++, learnedClause.data(),
+                             learnedClause.data(), proofHints);
+    }
+    return -1;
+  }
+  analyzeConflict(decisionLevel);
+  minimizeLearnedClause();
+  std::int32_t backtrackLevel{0};
+  for (std::size_t i{1}; i < learnedClause.size(); ++i) {
+    const auto level{variables.getDecisionLevel(std::abs(learnedClause[i]))};
+    if (level > backtrackLevel) {
+      backtrackLevel = level;
+      std::swap(learnedClause[1], learnedClause[i]);
+    }
+  }
+  const auto lbd{computeLbd(learnedClause.data(),
+                            learnedClause.data() + learnedClause.size())};
+  learnedClauseLbd = lbd;
+  if (proofWriter != nullptr) {
+    collectProofHints();
+  }
+  backtrack(backtrackLevel);
+  conflict = ClauseArena::NO_CLAUSE;
+  vsidsQueue.decay();
+  clauseActivityIncrement /= CLAUSE_ACTIVITY_DECAY;
+  const auto reference{addClause(learnedClause, true)};
+  auto clause{clauseArena[reference]};
+  clause.setLbd(lbd);
+  clause.setTier(lbd <= CORE_LBD    ? Clause::Tier::CORE
+                 : lbd <= TIER2_LBD ? Clause::Tier::TIER2
+                                    : Clause::Tier::LOCAL);
+  clause.setActivity(clauseActivityIncrement);
+  if (clauseExchange != nullptr &&
+      clauseExchange->exportClause(exchangeThread, learnedClause.data(),
+                                   learnedClause.data() + learnedClause.size(),
+                                   lbd)) {
+    ++exportedClauses;
+  }
+  if (proofWriter != nullptr) {
+    if (proofWriter->hasHints()) {
+      clauseIds.emplace(reference, nextClauseId);
+    }
+    proofWriter->addClause(nextClauseId++, learnedClause.data(),
+                           learnedClause.data() + learnedClause.size(),
+                           proofHints);
+  }
+  assign(learnedClause[0], reference, backtrackLevel);
+  if (++conflicts >= nextReduction) {
+    reduceLearnedClauses();
+  }
+  return backtrackLevel;
+}
+
+void cdclsolve::Formula::setProofWriter(ProofWriter &writer) {
+  proofWriter = &writer;
+  nextClauseId = clauses.size() + 1;
+  if (proofWriter->hasHints()) {
+    for (std::size_t i{0}; i < clauses.size(); ++i) {
+      clauseIds.emplace(clauses[i], i + 1);
+    }
+  }
+}
+
+bool cdclsolve::Formula::hasProofWriter() const {
+  return proofWriter != nullptr;
+}
+
+void cdclsolve::Formula::diversify(std::uint32_t seed, bool isPositivePhase) {
+  std::mt19937 generator{seed};
+  std::uniform_real_distribution<double> distribution{0.0, DIVERSIFY_ACTIVITY};
+  for (std::int32_t v{1}; v <= variables.getNumberOfVariables(); ++v) {
+    variables.setSavedLiteral(isPositivePhase ? v : -v);
+    vsidsQueue.setActivity(v, distribution(generator));
+  }
+}
+
+std::int32_t cdclsolve::Formula::getLearnedClauseLbd() const {
+  return learnedClauseLbd;
+}
+
+std::size_t cdclsolve::Formula::getLearnedClauseSize() const {
+  return learnedClause.size();
+}
+
+void cdclsolve::Formula::restart() { backtrack(0); }
+
+void cdclsolve::Formula::setClauseExchange(ClauseExchange &exchange,
+                                           std::size_t thread) {
+  clauseExchange = &exchange;
+  exchangeThread = thread;
+}
+
+bool cdclsolve::Formula::importClauses() {
+  if (clauseExchange == nullptr || !trailLimits.empty()) {
+    return false;
+  }
+  bool isImported{false};
+  std::int32_t lbd{0};
+  while (!hasConflict() &&
+         clauseExchange->importClause(exchangeThread, importedClause, lbd)) {
+    importClause(lbd);
+    isImported = true;
+  }
+  return isImported;
+}
+
+std::uint64_t cdclsolve::Formula::getConflicts() const { return conflicts; }
+
+std::uint64_t cdclsolve::Formula::getPropagations() const {
+  return propagations;
+}
+
+std::uint64_t cdclsolve::Formula::getReductions() const { return reductions; }
+
+bool cdclsolve::Formula::isReductionDue() const {
+  return conflicts + 1 >= nextReduction;
+}
+
+std::size_t cdclsolve::Formula::getTrailSize() const { return trail.size(); }
+
+std::size_t cdclsolve::Formula::getNumberOfLearnedClauses() const {
+  return learnedClauses.size();
+}
+
+std::uint64_t cdclsolve::Formula::getExportedClauses() const {
+  return exportedClauses;
+}
+
+std::uint64_t cdclsolve::Formula::getImportedClauses() const {
+  return importedClauses;
+}
+
+std::uint64_t cdclsolve::Formula::getUsefulClauses() const {
+  return usefulClauses;
+}
+
+std::size_t cdclsolve::Formula::getEliminatedVariables() const {
+  return eliminatedVariables;
+}
+
+cdclsolve::Formula cdclsolve::Formula::readBlocks(
+    const std::function<std::size_t(char *, std::size_t)> &read) {
+  std::vector<DimacsParser> parsers(1);
+  auto &parser{parsers.front()};
+  std::vector<char> buffer;
+  std::size_t filled{0};
+  bool isEnd{false};
+  while (!isEnd) {
+    buffer.resize(filled + INPUT_BUFFER_SIZE);
+    const auto count{read(buffer.data() + filled, INPUT_BUFFER_SIZE)};
+    filled += count;
+    isEnd = count == 0;
+    const auto begin{buffer.data()};
+    auto end{begin + filled};
+    if (!isEnd) {
+      while (end != begin && end[-1] != '\n') {
+        --end;
       }
     }
+    const char *p{begin};
+    if (!parser.hasHeader()) {
+      p = parser.parseHeader(p, end);
+    }
+    if (parser.hasHeader()) {
+      parser.parseClauses(p, end);
+    }
+    filled = static_cast<std::size_t>(std::copy(end, begin + filled, begin) -
+                                      begin);
   }
-  return literal;
+  return readClauses(parsers);
 }
 
-std::int32_t cdclsolve::Formula::decideVsids() const {
-  if (vsidsScoresPositive.empty() || vsidsScoresNegative.empty()) {
-    precomputeVsidsScores();
+cdclsolve::Formula
+cdclsolve::Formula::readClauses(std::vector<DimacsParser> &parsers) {
+  const auto &header{parsers.front()};
+  if (!header.hasHeader()) {
+    throw std::runtime_error(
+        "unexpected end of file while parsing problem line");
   }
-  std::int32_t literal{0};
-  std::int32_t maxScore{-1};
-  for (std::size_t vi{1}; vi < variables.size(); ++vi) {
-    if (!variables.at(vi)->isAssigned()) {
-      if (auto score{vsidsScoresPositive[vi]}; score > maxScore) {
-        literal = vi;
-        maxScore = score;
+  const auto numberOfClauses{header.getNumberOfClauses()};
+  Formula formula{header.getNumberOfAtoms(), numberOfClauses};
+  std::size_t size{0};
+  for (const auto &parser : parsers) {
+    size += parser.getSize();
+  }
+  formula.clauses.reserve(static_cast<std::size_t>(numberOfClauses));
+  formula.clauseArena.reserve(size + Clause::HEADER_SIZE * numberOfClauses);
+  std::vector<std::int32_t> clause;
+  for (auto &parser : parsers) {
+    for (const auto literal : parser.takeLiterals()) {
+      if (literal != 0) {
+        clause.push_back(literal);
+        continue;
       }
-      if (auto score{vsidsScoresNegative[vi]}; score > maxScore) {
-        literal = -vi;
-        maxScore = score;
+      std::sort(clause.begin(), clause.end());
+      clause.erase(std::unique(clause.begin(), clause.end()), clause.end());
+      formula.addClause(clause, false);
+      clause.clear();
+    }
+  }
+  if (!clause.empty()) {
+    throw std::runtime_error("unexpected end of file while parsing clause");
+  }
+  if (formula.clauses.size() != static_cast<std::size_t>(numberOfClauses)) {
+    throw std::runtime_error(
+        "invalid number of clauses: expected " +
+        std::to_string(numberOfClauses) + " clauses but parsed " +
+        std::to_string(formula.clauses.size()) + " clauses");
+  }
+  formula.assignUnitClauses();
+  return formula;
+}
+
+cdclsolve::Formula cdclsolve::Formula::readBinary(const char *begin,
+                                                  const char *end) {
+  std::uint32_t version;
+  std::int32_t numberOfAtoms;
+  std::int32_t numberOfClauses;
+  std::uint32_t reserved;
+  std::uint64_t numberOfLiterals;
+  auto p{begin + BINARY_MAGIC.size()};
+  const auto readField{[&p, end](auto &field) {
+    if (static_cast<std::size_t>(end - p) < sizeof(field)) {
+      throw std::runtime_error("unexpected end of binary formula");
+    }
+    std::memcpy(&field, p, sizeof(field));
+    p += sizeof(field);
+  }};
+  readField(version);
+  if (version != BINARY_VERSION) {
+    throw std::runtime_error("unsupported binary formula version: expected " +
+                             std::to_string(BINARY_VERSION) + " but got " +
+                             std::to_string(version));
+  }
+  readField(numberOfAtoms);
+  readField(numberOfClauses);
+  readField(reserved);
+  readField(numberOfLiterals);
+  if (numberOfAtoms < 0 || numberOfClauses < 0 ||
+      static_cast<std::uint64_t>(end - p) !=
+          (static_cast<std::uint64_t>(numberOfClauses) + 1) *
+                  sizeof(std::uint64_t) +
+              numberOfLiterals * sizeof(std::int32_t)) {
+    throw std::runtime_error("invalid size of binary formula");
+  }
+  const auto offsets{reinterpret_cast<const std::uint64_t *>(p)};
+  const auto literals{
+      reinterpret_cast<const std::int32_t *>(offsets + numberOfClauses + 1)};
+  Formula formula{numberOfAtoms, numberOfClauses};
+  formula.clauses.reserve(static_cast<std::size_t>(numberOfClauses));
+  formula.clauseArena.reserve(numberOfLiterals +
+                              Clause::HEADER_SIZE * numberOfClauses);
+  std::vector<std::int32_t> clause;
+  for (std::int32_t i{0}; i < numberOfClauses; ++i) {
+    if (offsets[i] > offsets[i + 1] || offsets[i + 1] > numberOfLiterals) {
+      throw std::runtime_error("invalid clause offset in binary formula");
+    }
+    clause.assign(literals + offsets[i], literals + offsets[i + 1]);
+    for (const auto l : clause) {
+      if (l == 0 || std::abs(l) > numberOfAtoms) {
+        throw std::runtime_error("invalid literal in binary formula: " +
+                                 std::to_string(l));
       }
     }
+    formula.addClause(clause, false);
   }
-  return literal;
+  formula.assignUnitClauses();
+  return formula;
 }
 
-bool cdclsolve::Formula::hasConflict() const { return (bool)conflict; }
+void cdclsolve::Formula::writeBinary(const Formula &formula,
+                                     std::ostream &to) {
+  std::vector<std::uint64_t> offsets{0};
+  offsets.reserve(formula.clauses.size() + 1);
+  for (const auto c : formula.clauses) {
+    offsets.push_back(offsets.back() + formula.clauseArena[c].size());
+  }
+  const auto writeField{[&to](const auto &field) {
+    to.write(reinterpret_cast<const char *>(&field), sizeof(field));
+  }};
+  to.write(BINARY_MAGIC.data(), BINARY_MAGIC.size());
+  writeField(BINARY_VERSION);
+  writeField(formula.variables.getNumberOfVariables());
+  writeField(static_cast<std::int32_t>(formula.clauses.size()));
+  writeField(std::uint32_t{0});
+  writeField(offsets.back());
+  to.write(reinterpret_cast<const char *>(offsets.data()),
+           offsets.size() * sizeof(std::uint64_t));
+  for (const auto c : formula.clauses) {
+    const auto clause{formula.clauseArena[c]};
+    to.write(reinterpret_cast<const char *>(clause.begin()),
+             clause.size() * sizeof(std::int32_t));
+  }
+}
 
-std::int32_t cdclsolve::Formula::resolveConflict(std::int32_t decisionLevel) {
-  std::int32_t backtrackLevel{decisionLevel};
-  std::vector<std::pair<std::shared_ptr<Variable>, bool>> antecedent;
-  for (const auto &l : conflict->getAntecedent()->getLiterals()) {
-    antecedent.push_back({variables[std::abs(l)], l > 0});
-  }
-  auto conflictClause{std::make_shared<Clause>(antecedent)};
-  while (resolveConflict(decisionLevel, conflictClause)) {
-  }
-  if (conflictClause->size() == 0) {
-    backtrackLevel = -1;
-  } else if (conflictClause->size() == 1) {
-    backtrackLevel =
-        variables[std::abs(conflictClause->getLiteralsAsVector()[0])]
-            ->getDecisionLevel() -
-        1;
-  } else {
-    for (const auto &l : conflictClause->getLiterals()) {
-      backtrackLevel =
-          std::min(backtrackLevel, variables[std::abs(l)]->getDecisionLevel());
-    }
-  }
-  if (backtrackLevel >= 0) {
-    while (decisionLevel >= backtrackLevel) {
-      for (auto &v : variables) {
-        if (v->getDecisionLevel() == decisionLevel) {
-          unassign(v);
-        }
-      }
-      --decisionLevel;
+void cdclsolve::Formula::assignUnitClauses() {
+  for (const auto c : clauses) {
+    const auto clause{clauseArena[c]};
+    if (clause.size() > 1) {
+      continue;
+    }
+    if (clause.isUnsatisfied(variables)) {
+      conflict = c;
+      break;
+    }
+    if (!clause.isSatisfied(variables)) {
+      assign(clause[0], c, 0);
     }
-    conflict.reset();
   }
-  updateVsidsScores(conflictClause->getLiterals());
-  addClause(conflictClause);
-  return backtrackLevel;
+}
+
+void cdclsolve::Formula::importClause(std::int32_t lbd) {
+  std::size_t kept{0};
+  for (const auto l : importedClause) {
+    if (variables.isTrue(l)) {
+      return;
+    }
+    if (!variables.isFalse(l)) {
+      importedClause[kept++] = l;
+    }
+  }
+  if (kept > 0) {
+    importedClause.resize(kept);
+  }
+  ++importedClauses;
+  const auto reference{addClause(importedClause, true)};
+  auto clause{clauseArena[reference]};
+  lbd = std::min(lbd, static_cast<std::int32_t>(kept));
+  clause.setLbd(lbd);
+  clause.setTier(lbd <= CORE_LBD    ? Clause::Tier::CORE
+                 : lbd <= TIER2_LBD ? Clause::Tier::TIER2
+                                    : Clause::Tier::LOCAL);
+  clause.setActivity(clauseActivityIncrement);
+  clause.setFlag(Clause::FLAG_IMPORTED, true);
+  if (kept == 0) {
+    conflict = reference;
+  } else if (kept == 1) {
+    assign(clause[0], reference, 0);
+  }
+}
+
+std::size_t cdclsolve::Formula::probe(std::int32_t literal) {
+  const auto decisionLevel{static_cast<std::int32_t>(trailLimits.size())};
+  const auto begin{trail.size()};
+  assign(literal, decisionLevel + 1);
+  propagateUnitLiterals(decisionLevel + 1);
+  const auto assigned{hasConflict() ? std::numeric_limits<std::size_t>::max()
+                                    : trail.size() - begin};
+  cancel(decisionLevel);
+  return assigned;
 }
 
 cdclsolve::Formula::Formula(std::int32_t numberOfAtoms,
                             std::int32_t numberOfClauses)
-    : numberOfClauses{numberOfClauses} {
-  for (std::int32_t i{0}; i <= numberOfAtoms; ++i) {
-    variables.push_back(std::make_shared<Variable>(i));
+    : numberOfClauses{numberOfClauses}, variables{numberOfAtoms},
+      watches(2 * static_cast<std::size_t>(numberOfAtoms) + 2),
+      occurrences(2 * static_cast<std::size_t>(numberOfAtoms) + 2),
+      seen(static_cast<std::size_t>(numberOfAtoms) + 1, 0),
+      levelStamps(static_cast<std::size_t>(numberOfAtoms) + 1, 0),
+      vsidsQueue{numberOfAtoms},
+      jeroslowWangQueue{2 * static_cast<std::size_t>(numberOfAtoms) + 2},
+      dlisQueue{2 * static_cast<std::size_t>(numberOfAtoms) + 2} {}
+
+cdclsolve::ClauseReference
+cdclsolve::Formula::addClause(const std::vector<std::int32_t> &literals,
+                              bool isLearned) {
+  const auto clause{clauseArena.add(literals, isLearned)};
+  (isLearned ? learnedClauses : clauses).push_back(clause);
+  if (literals.size() > 1) {
+    watches[VariableStore::getLiteralIndex(literals[0])].push_back(clause);
+    watches[VariableStore::getLiteralIndex(literals[1])].push_back(clause);
+  }
+  const auto weight{std::ldexp(1.0, -static_cast<int>(literals.size()))};
+  const auto isSatisfied{isDlisQueueActive &&
+                         clauseArena[clause].isSatisfied(variables)};
+  for (std::int32_t l : literals) {
+    const auto index{VariableStore::getLiteralIndex(l)};
+    occurrences[index].push_back(clause);
+    if (isJeroslowWangQueueActive) {
+      jeroslowWangQueue.setScore(index,
+                                 jeroslowWangQueue.getScore(index) + weight);
+    }
+    if (isDlisQueueActive && !isSatisfied) {
+      dlisQueue.setScore(index, dlisQueue.getScore(index) + 1.0);
+    }
+  }
+  return clause;
+}
+
+void cdclsolve::Formula::assign(std::int32_t literal,
+                                ClauseReference antecedent,
+                                std::int32_t decisionLevel) {
+  variables.assign(literal, antecedent, decisionLevel);
+  trail.push_back(literal);
+  if (isDlisQueueActive) {
+    updateDlisScores(literal, -1.0);
   }
 }
 
-bool cdclsolve::Formula::isSatisfied() const {
-  for (const auto &c : clauses) {
-    if (!c->isSatisfied()) {
-      return false;
+void cdclsolve::Formula::backtrack(std::int32_t backtrackLevel) {
+  if (trailLimits.size() <= static_cast<std::size_t>(backtrackLevel)) {
+    return;
+  }
+  const auto limit{trailLimits[backtrackLevel]};
+  while (trail.size() > limit) {
+    const auto literal{trail.back()};
+    if (isDlisQueueActive) {
+      updateDlisScores(literal, 1.0);
+    }
+    variables.unassign(std::abs(literal));
+    vsidsQueue.insert(std::abs(literal));
+    if (isJeroslowWangQueueActive) {
+      jeroslowWangQueue.insert(VariableStore::getLiteralIndex(literal));
+      jeroslowWangQueue.insert(VariableStore::getLiteralIndex(-literal));
     }
+    if (isDlisQueueActive) {
+      dlisQueue.insert(VariableStore::getLiteralIndex(literal));
+      dlisQueue.insert(VariableStore::getLiteralIndex(-literal));
+    }
+    trail.pop_back();
   }
-  return true;
+  trailLimits.resize(backtrackLevel);
+  propagationHead = trail.size();
 }
 
-bool cdclsolve::Formula::isUnsatisfied() const {
-  for (const auto &c : clauses) {
-    if (c->isUnsatisfied()) {
-      return true;
+void cdclsolve::Formula::analyzeConflict(std::int32_t decisionLevel) {
+  learnedClause.assign(1, 0);
+  std::int32_t pathCount{0};
+  std::int32_t literal{0};
+  auto reason{conflict};
+  auto trailPosition{trail.size()};
+  do {
+    if (clauseArena[reason].hasFlag(Clause::FLAG_LEARNED)) {
+      updateLearnedClause(reason);
+    }
+    for (const auto l : clauseArena[reason]) {
+      const auto variable{std::abs(l)};
+      if (l == literal || seen[variable] ||
+          variables.getDecisionLevel(variable) == 0) {
+        continue;
+      }
+      seen[variable] = 1;
+      vsidsQueue.bump(variable);
+      if (variables.getDecisionLevel(variable) >= decisionLevel) {
+        ++pathCount;
+      } else {
+        learnedClause.push_back(l);
+      }
+    }
+    while (!seen[std::abs(trail[--trailPosition])]) {
+    }
+    literal = trail[trailPosition];
+    reason = variables.getReason(std::abs(literal));
+    seen[std::abs(literal)] = 0;
+    --pathCount;
+  } while (pathCount > 0);
+  learnedClause[0] = -literal;
+}
+
+void cdclsolve::Formula::collectProofHints() {
+  proofHints.clear();
+  if (!proofWriter->hasHints()) {
+    return;
+  }
+  analyzeToClear.clear();
+  for (const auto l : learnedClause) {
+    seen[std::abs(l)] = 1;
+    analyzeToClear.push_back(l);
+  }
+  analyzeStack.clear();
+  for (const auto l : clauseArena[conflict]) {
+    analyzeStack.push_back(std::abs(l));
+  }
+  while (!analyzeStack.empty()) {
+    const auto variable{analyzeStack.back()};
+    if (variable < 0) {
+      analyzeStack.pop_back();
+      proofHints.push_back(clauseIds.at(variables.getReason(-variable)));
+      continue;
+    }
+    if (seen[variable]) {
+      analyzeStack.pop_back();
+      continue;
+    }
+    seen[variable] = 1;
+    analyzeToClear.push_back(variable);
+    analyzeStack.back() = -variable;
+    for (const auto l : clauseArena[variables.getReason(variable)]) {
+      if (!seen[std::abs(l)]) {
+        analyzeStack.push_back(std::abs(l));
+      }
     }
   }
-  return false;
+  proofHints.push_back(clauseIds.at(conflict));
+  for (const auto l : analyzeToClear) {
+    seen[std::abs(l)] = 0;
+  }
 }
 
-void cdclsolve::Formula::addClause(std::shared_ptr<Clause> clause) {
-  clauses.push_back(clause);
-  for (std::int32_t l : clause->getLiterals()) {
-    if (l > 0) {
-      variables.at(l)->addPositiveOccurance(clause);
-    } else {
-      variables.at(-l)->addNegativeOccurance(clause);
+void cdclsolve::Formula::minimizeLearnedClause() {
+  std::uint32_t abstractLevels{0};
+  for (std::size_t i{1}; i < learnedClause.size(); ++i) {
+    abstractLevels |= getAbstractLevel(std::abs(learnedClause[i]));
+  }
+  analyzeToClear.assign(learnedClause.cbegin(), learnedClause.cend());
+  std::size_t kept{1};
+  for (std::size_t i{1}; i < learnedClause.size(); ++i) {
+    const auto literal{learnedClause[i]};
+    if (variables.getReason(std::abs(literal)) == ClauseArena::NO_CLAUSE ||
+        !isRedundant(literal, abstractLevels)) {
+      learnedClause[kept++] = literal;
     }
   }
+  learnedClause.resize(kept);
+  for (const auto l : analyzeToClear) {
+    seen[std::abs(l)] = 0;
+  }
 }
 
-void cdclsolve::Formula::assignTrue(std::int32_t variable,
-                                    std::shared_ptr<Clause> antecedent,
-                                    std::int32_t decisionLevel) {
-  variables.at(variable)->assignTrue(antecedent, decisionLevel);
+bool cdclsolve::Formula::isRedundant(std::int32_t literal,
+                                     std::uint32_t abstractLevels) {
+  analyzeStack.assign(1, literal);
+  const auto top{analyzeToClear.size()};
+  while (!analyzeStack.empty()) {
+    const auto variable{std::abs(analyzeStack.back())};
+    analyzeStack.pop_back();
+    for (const auto l : clauseArena[variables.getReason(variable)]) {
+      const auto v{std::abs(l)};
+      if (v == variable || seen[v] || variables.getDecisionLevel(v) == 0) {
+        continue;
+      }
+      if (variables.getReason(v) == ClauseArena::NO_CLAUSE ||
+          (getAbstractLevel(v) & abstractLevels) == 0) {
+        for (auto k{top}; k < analyzeToClear.size(); ++k) {
+          seen[std::abs(analyzeToClear[k])] = 0;
+        }
+        analyzeToClear.resize(top);
+        return false;
+      }
+      seen[v] = 1;
+      analyzeStack.push_back(l);
+      analyzeToClear.push_back(l);
+    }
+  }
+  return true;
 }
 
-void cdclsolve::Formula::assignFalse(std::int32_t variable,
-                                     std::shared_ptr<Clause> antecedent,
-                                     std::int32_t decisionLevel) {
-  variables.at(variable)->assignFalse(antecedent, decisionLevel);
+std::uint32_t
+cdclsolve::Formula::getAbstractLevel(std::int32_t variable) const {
+  return 1u << (variables.getDecisionLevel(variable) & 31);
 }
 
-void cdclsolve::Formula::unassign(std::shared_ptr<Variable> variable) {
-  variable->unassign();
+std::int32_t cdclsolve::Formula::computeLbd(const std::int32_t *begin,
+                                            const std::int32_t *end) {
+  ++levelStamp;
+  std::int32_t lbd{0};
+  for (auto it{begin}; it != end; ++it) {
+    const auto level{variables.getDecisionLevel(std::abs(*it))};
+    if (level >= 0 && levelStamps[level] != levelStamp) {
+      levelStamps[level] = levelStamp;
+      ++lbd;
+    }
+  }
+  return lbd;
 }
 
-std::int32_t cdclsolve::Formula::getAnswer() const {
-  if (isSatisfied()) {
-    return 1;
+void cdclsolve::Formula::updateLearnedClause(ClauseReference reference) {
+  auto clause{clauseArena[reference]};
+  clause.setFlag(Clause::FLAG_USED, true);
+  if (clause.hasFlag(Clause::FLAG_IMPORTED)) {
+    clause.setFlag(Clause::FLAG_IMPORTED, false);
+    ++usefulClauses;
   }
-  if (isUnsatisfied()) {
-    return -1;
+  clause.setActivity(clause.getActivity() + clauseActivityIncrement);
+  if (clause.getActivity() > CLAUSE_ACTIVITY_RESCALE_LIMIT) {
+    for (const auto c : learnedClauses) {
+      auto learned{clauseArena[c]};
+      learned.setActivity(learned.getActivity() /
+                          CLAUSE_ACTIVITY_RESCALE_LIMIT);
+    }
+    clauseActivityIncrement /= CLAUSE_ACTIVITY_RESCALE_LIMIT;
+  }
+  if (clause.getTier() == Clause::Tier::CORE) {
+    return;
+  }
+  const auto lbd{computeLbd(clause.begin(), clause.end())};
+  if (lbd < clause.getLbd()) {
+    clause.setLbd(lbd);
+    if (lbd <= CORE_LBD) {
+      clause.setTier(Clause::Tier::CORE);
+    } else if (lbd <= TIER2_LBD) {
+      clause.setTier(Clause::Tier::TIER2);
+    }
   }
-  return 0;
 }
 
-bool cdclsolve::Formula::resolveConflict(
-    std::int32_t decisionLevel, std::shared_ptr<Clause> conflictClause) {
-  auto assignedLiteralsAtDecisionLevel{0};
-  std::shared_ptr<Variable> decisionVariable;
-  for (const auto literal : conflictClause->getLiterals()) {
-    std::shared_ptr<Variable> variable{variables[std::abs(literal)]};
-    if (variable->getDecisionLevel() == decisionLevel) {
-      ++assignedLiteralsAtDecisionLevel;
-      if (variable->getAntecedent() && !decisionVariable) {
-        decisionVariable = variable;
-      }
-      if (assignedLiteralsAtDecisionLevel > 1 && decisionVariable) {
-        conflictClause->resolve(decisionVariable->getAntecedent());
-        return true;
-      }
+void cdclsolve::Formula::reduceLearnedClauses() {
+  std::vector<ClauseReference> candidates;
+  for (const auto c : learnedClauses) {
+    auto clause{clauseArena[c]};
+    if (clause.getTier() == Clause::Tier::TIER2 &&
+        !clause.hasFlag(Clause::FLAG_USED)) {
+      clause.setTier(Clause::Tier::LOCAL);
+    } else if (clause.getTier() == Clause::Tier::LOCAL &&
+               !clause.hasFlag(Clause::FLAG_USED) && !isLocked(c)) {
+      candidates.push_back(c);
     }
+    clause.setFlag(Clause::FLAG_USED, false);
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [this](ClauseReference a, ClauseReference b) {
+              const auto clauseA{clauseArena[a]};
+              const auto clauseB{clauseArena[b]};
+              if (clauseA.getLbd() != clauseB.getLbd()) {
+                return clauseA.getLbd() > clauseB.getLbd();
+              }
+              return clauseA.getActivity() < clauseB.getActivity();
+            });
+  candidates.resize(candidates.size() / 2);
+  for (const auto c : candidates) {
+    removeClause(c);
   }
-  return false;
+  const auto isDeleted{[this](ClauseReference c) {
+    return clauseArena[c].hasFlag(Clause::FLAG_DELETED);
+  }};
+  learnedClauses.erase(std::remove_if(learnedClauses.begin(),
+                                      learnedClauses.end(), isDeleted),
+                       learnedClauses.end());
+  for (auto &watchList : watches) {
+    watchList.erase(
+        std::remove_if(watchList.begin(), watchList.end(), isDeleted),
+        watchList.end());
+  }
+  for (auto &occurrenceList : occurrences) {
+    occurrenceList.erase(std::remove_if(occurrenceList.begin(),
+                                        occurrenceList.end(), isDeleted),
+                         occurrenceList.end());
+  }
+  if (clauseArena.getWastedSize() > clauseArena.getMemorySize() / 5) {
+    collectGarbage();
+  }
+  ++reductions;
+  nextReduction = conflicts + REDUCE_INTERVAL + reductions * REDUCE_INCREMENT;
+}
+
+bool cdclsolve::Formula::isLocked(ClauseReference reference) const {
+  const auto clause{clauseArena[reference]};
+  return clause.size() > 0 &&
+         variables.getReason(std::abs(clause[0])) == reference &&
+         variables.isTrue(clause[0]);
 }
 
-float cdclsolve::Formula::getJeroslowWangHeuristic(std::int32_t literal) const {
-  float h{0.0f};
-  for (const auto &clause : clauses) {
-    if (clause->hasLiteral(literal)) {
-      h += std::pow(2.0f, -clause->size());
+void cdclsolve::Formula::removeClause(ClauseReference reference) {
+  const auto clause{clauseArena[reference]};
+  const auto weight{std::ldexp(1.0, -static_cast<int>(clause.size()))};
+  const auto isSatisfied{clause.isSatisfied(variables)};
+  for (const auto l : clause) {
+    const auto index{VariableStore::getLiteralIndex(l)};
+    if (isJeroslowWangQueueActive) {
+      jeroslowWangQueue.setScore(index,
+                                 jeroslowWangQueue.getScore(index) - weight);
+    }
+    if (isDlisQueueActive && !isSatisfied) {
+      dlisQueue.setScore(index, dlisQueue.getScore(index) - 1.0);
+    }
+  }
+  if (proofWriter != nullptr) {
+    std::uint64_t id{0};
+    if (const auto entry{clauseIds.find(reference)};
+        entry != clauseIds.end()) {
+      id = entry->second;
+      clauseIds.erase(entry);
     }
+    proofWriter->deleteClause(id, clause.begin(), clause.end());
   }
-  return h;
+  clauseArena.remove(reference);
 }
 
-std::int32_t
-cdclsolve::Formula::getSatisfyingClauses(std::int32_t literal) const {
-  std::int32_t satisfyingClauses{0};
-  for (const auto &c : clauses) {
-    if (c->isUndecided() && c->isSatisfying(literal)) {
-      ++satisfyingClauses;
+void cdclsolve::Formula::collectGarbage() {
+  ClauseArena target;
+  target.reserve((clauseArena.getMemorySize() - clauseArena.getWastedSize()) /
+                 sizeof(std::int32_t));
+  for (auto &c : clauses) {
+    c = clauseArena.relocate(c, target);
+  }
+  for (auto &c : learnedClauses) {
+    c = clauseArena.relocate(c, target);
+  }
+  for (auto &watchList : watches) {
+    for (auto &c : watchList) {
+      c = clauseArena.relocate(c, target);
+    }
+  }
+  for (auto &occurrenceList : occurrences) {
+    for (auto &c : occurrenceList) {
+      c = clauseArena.relocate(c, target);
     }
   }
-  return satisfyingClauses;
+  for (const auto l : trail) {
+    const auto variable{std::abs(l)};
+    if (const auto reason{variables.getReason(variable)};
+        reason != ClauseArena::NO_CLAUSE) {
+      variables.setReason(variable, clauseArena.relocate(reason, target));
+    }
+  }
+  std::unordered_map<ClauseReference, std::uint64_t> relocatedClauseIds;
+  relocatedClauseIds.reserve(clauseIds.size());
+  for (const auto &[c, id] : clauseIds) {
+    relocatedClauseIds.emplace(clauseArena.relocate(c, target), id);
+  }
+  clauseIds = std::move(relocatedClauseIds);
+  clauseArena = std::move(target);
 }
 
-void cdclsolve::Formula::precomputeVsidsScores() const {
-  vsidsScoresPositive = std::vector<std::int32_t>(variables.size(), 0);
-  vsidsScoresNegative = std::vector<std::int32_t>(variables.size(), 0);
-  for (std::int32_t atom{1}; atom < variables.size(); ++atom) {
-    vsidsScoresPositive[atom] = getSatisfyingClauses(atom);
-    vsidsScoresNegative[atom] = getSatisfyingClauses(-atom);
+std::int32_t cdclsolve::Formula::decideLiteral(ScoreHeap &queue) const {
+  while (!queue.isEmpty()) {
+    const auto literal{VariableStore::getLiteral(queue.removeMax())};
+    if (!variables.isAssigned(std::abs(literal))) {
+      return literal;
+    }
   }
+  return 0;
 }
 
-void cdclsolve::Formula::updateVsidsScores(
-    const std::set<std::int32_t> &conflictClause) const {
-  if (!vsidsScoresPositive.empty() && !vsidsScoresNegative.empty()) {
-    static std::int32_t rebalanceCount{32};
-    for (const auto &literal : conflictClause) {
-      if (literal > 0) {
-        ++vsidsScoresPositive[literal];
-      } else {
-        ++vsidsScoresNegative[-literal];
-      }
+void cdclsolve::Formula::initializeJeroslowWangQueue() const {
+  for (const auto c : clauses) {
+    const auto clause{clauseArena[c]};
+    const auto weight{std::ldexp(1.0, -static_cast<int>(clause.size()))};
+    for (const auto l : clause) {
+      const auto index{VariableStore::getLiteralIndex(l)};
+      jeroslowWangQueue.setScore(index,
+                                 jeroslowWangQueue.getScore(index) + weight);
     }
-    --rebalanceCount;
-    if (rebalanceCount == 0) {
-      rebalanceVsidsScores();
-      rebalanceCount = 32;
+  }
+  for (std::int32_t vi{1}; vi <= variables.getNumberOfVariables(); ++vi) {
+    if (!variables.isAssigned(vi)) {
+      jeroslowWangQueue.insert(VariableStore::getLiteralIndex(vi));
+      jeroslowWangQueue.insert(VariableStore::getLiteralIndex(-vi));
     }
   }
+  isJeroslowWangQueueActive = true;
 }
 
-void cdclsolve::Formula::rebalanceVsidsScores() const {
-  for (auto &s : vsidsScoresPositive) {
-    s /= 2;
+void cdclsolve::Formula::initializeDlisQueue() const {
+  for (const auto c : clauses) {
+    const auto clause{clauseArena[c]};
+    if (clause.isSatisfied(variables)) {
+      continue;
+    }
+    for (const auto l : clause) {
+      const auto index{VariableStore::getLiteralIndex(l)};
+      dlisQueue.setScore(index, dlisQueue.getScore(index) + 1.0);
+    }
+  }
+  for (std::int32_t vi{1}; vi <= variables.getNumberOfVariables(); ++vi) {
+    if (!variables.isAssigned(vi)) {
+      dlisQueue.insert(VariableStore::getLiteralIndex(vi));
+      dlisQueue.insert(VariableStore::getLiteralIndex(-vi));
+    }
   }
-  for (auto &s : vsidsScoresNegative) {
-    s /= 2;
+  isDlisQueueActive = true;
+}
+
+void cdclsolve::Formula::updateDlisScores(std::int32_t literal,
+                                          double delta) const {
+  for (const auto c : occurrences[VariableStore::getLiteralIndex(literal)]) {
+    const auto clause{clauseArena[c]};
+    if (std::any_of(clause.begin(), clause.end(), [this, literal](auto l) {
+          return l != literal && variables.isTrue(l);
+        })) {
+      continue;
+    }
+    for (const auto l : clause) {
+      const auto index{VariableStore::getLiteralIndex(l)};
+      dlisQueue.setScore(index, dlisQueue.getScore(index) + delta);
+    }
   }
 }
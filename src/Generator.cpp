@@ -0,0 +1,141 @@
+#include <cdclsolve/Generator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+#include <sstream>
+
+cdclsolve::Generator::Generator(std::uint32_t seed) : generator{seed} {}
+
+cdclsolve::Generator::Cnf
+cdclsolve::Generator::randomKSat(std::int32_t k,
+                                 std::int32_t numberOfVariables,
+                                 double clauseRatio) {
+  Cnf cnf{numberOfVariables, {}};
+  const auto numberOfClauses{
+      static_cast<std::size_t>(std::lround(numberOfVariables * clauseRatio))};
+  while (cnf.clauses.size() < numberOfClauses) {
+    std::vector<std::int32_t> clause;
+    while (clause.size() < static_cast<std::size_t>(k)) {
+      const auto variable{static_cast<std::int32_t>(
+          next(static_cast<std::uint32_t>(numberOfVariables)) + 1)};
+      if (std::none_of(clause.begin(), clause.end(), [variable](auto l) {
+            return std::abs(l) == variable;
+          })) {
+        clause.push_back(next(2) == 0 ? variable : -variable);
+      }
+    }
+    cnf.clauses.push_back(std::move(clause));
+  }
+  return cnf;
+}
+
+cdclsolve::Generator::Cnf
+cdclsolve::Generator::parity(std::int32_t numberOfVariables) {
+  Cnf cnf{numberOfVariables, {}};
+  std::vector<std::int32_t> variables(numberOfVariables);
+  std::iota(variables.begin(), variables.end(), 1);
+  addXorChain(cnf, variables, true);
+  for (auto i{variables.size()}; i > 1; --i) {
+    std::swap(variables[i - 1],
+              variables[next(static_cast<std::uint32_t>(i))]);
+  }
+  addXorChain(cnf, variables, false);
+  return cnf;
+}
+
+cdclsolve::Generator::Cnf
+cdclsolve::Generator::graphColoring(std::int32_t numberOfVertices,
+                                    double averageDegree,
+                                    std::int32_t numberOfColors) {
+  Cnf cnf{numberOfVertices * numberOfColors, {}};
+  const auto color{[numberOfColors](std::int32_t vertex, std::int32_t c) {
+    return vertex * numberOfColors + c + 1;
+  }};
+  for (std::int32_t v{0}; v < numberOfVertices; ++v) {
+    std::vector<std::int32_t> clause;
+    for (std::int32_t c{0}; c < numberOfColors; ++c) {
+      clause.push_back(color(v, c));
+      for (std::int32_t d{c + 1}; d < numberOfColors; ++d) {
+        cnf.clauses.push_back({-color(v, c), -color(v, d)});
+      }
+    }
+    cnf.clauses.push_back(std::move(clause));
+  }
+  const auto numberOfEdges{
+      std::lround(numberOfVertices * averageDegree / 2.0)};
+  for (long e{0}; e < numberOfEdges; ++e) {
+    const auto u{static_cast<std::int32_t>(
+        next(static_cast<std::uint32_t>(numberOfVertices)))};
+    const auto v{static_cast<std::int32_t>(
+        next(static_cast<std::uint32_t>(numberOfVertices)))};
+    if (u == v) {
+      continue;
+    }
+    for (std::int32_t c{0}; c < numberOfColors; ++c) {
+      cnf.clauses.push_back({-color(u, c), -color(v, c)});
+    }
+  }
+  return cnf;
+}
+
+cdclsolve::Generator::Cnf
+cdclsolve::Generator::pigeonhole(std::int32_t numberOfHoles) {
+  const auto numberOfPigeons{numberOfHoles + 1};
+  Cnf cnf{numberOfPigeons * numberOfHoles, {}};
+  const auto sits{[numberOfHoles](std::int32_t pigeon, std::int32_t hole) {
+    return pigeon * numberOfHoles + hole + 1;
+  }};
+  for (std::int32_t p{0}; p < numberOfPigeons; ++p) {
+    std::vector<std::int32_t> clause;
+    for (std::int32_t h{0}; h < numberOfHoles; ++h) {
+      clause.push_back(sits(p, h));
+    }
+    cnf.clauses.push_back(std::move(clause));
+  }
+  for (std::int32_t h{0}; h < numberOfHoles; ++h) {
+    for (std::int32_t p{0}; p < numberOfPigeons; ++p) {
+      for (std::int32_t q{p + 1}; q < numberOfPigeons; ++q) {
+        cnf.clauses.push_back({-sits(p, h), -sits(q, h)});
+      }
+    }
+  }
+  return cnf;
+}
+
+void cdclsolve::Generator::writeDimacs(const Cnf &cnf, std::ostream &to) {
+  to << "p cnf " << cnf.numberOfVariables << ' ' << cnf.clauses.size()
+     << '\n';
+  for (const auto &clause : cnf.clauses) {
+    for (const auto literal : clause) {
+      to << literal << ' ';
+    }
+    to << "0\n";
+  }
+}
+
+cdclsolve::Formula cdclsolve::Generator::toFormula(const Cnf &cnf) {
+  std::stringstream dimacs;
+  writeDimacs(cnf, dimacs);
+  return Formula::readInput(dimacs);
+}
+
+std::uint32_t cdclsolve::Generator::next(std::uint32_t bound) {
+  return static_cast<std::uint32_t>(generator() % bound);
+}
+
+void cdclsolve::Generator::addXorChain(
+    Cnf &cnf, const std::vector<std::int32_t> &variables, bool isOdd) {
+  auto previous{variables.front()};
+  for (std::size_t i{1}; i < variables.size(); ++i) {
+    const auto x{variables[i]};
+    const auto t{++cnf.numberOfVariables};
+    cnf.clauses.push_back({-t, previous, x});
+    cnf.clauses.push_back({-t, -previous, -x});
+    cnf.clauses.push_back({t, -previous, x});
+    cnf.clauses.push_back({t, previous, -x});
+    previous = t;
+  }
+  cnf.clauses.push_back({isOdd ? previous : -previous});
+}
@@ -0,0 +1,63 @@
+#include <cdclsolve/IncrementalSolver.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+
+cdclsolve::IncrementalSolver::IncrementalSolver(
+    const std::string &decisionHeuristic, const std::string &restartStrategy)
+    : solver{formula, decisionHeuristic, restartStrategy} {}
+
+void cdclsolve::IncrementalSolver::add(std::int32_t literal) {
+  if (literal != 0) {
+    clause.push_back(literal);
+    return;
+  }
+  formula.addClause(clause);
+  clause.clear();
+}
+
+void cdclsolve::IncrementalSolver::addClause(
+    const std::vector<std::int32_t> &literals) {
+  formula.addClause(literals);
+}
+
+void cdclsolve::IncrementalSolver::assume(std::int32_t literal) {
+  formula.addVariables(std::abs(literal));
+  assumptions.push_back(literal);
+}
+
+cdclsolve::Solver::Result cdclsolve::IncrementalSolver::solve() {
+  const auto result{solver.solve(assumptions)};
+  assumptions.clear();
+  return result;
+}
+
+std::int32_t cdclsolve::IncrementalSolver::value(std::int32_t literal) const {
+  const auto &variables{formula.getVariables()};
+  if (std::abs(literal) > variables.getNumberOfVariables()) {
+    return 0;
+  }
+  return variables.isTrue(literal)    ? literal
+         : variables.isFalse(literal) ? -literal
+                                      : 0;
+}
+
+bool cdclsolve::IncrementalSolver::failed(std::int32_t literal) const {
+  const auto &failedAssumptions{solver.getFailedAssumptions()};
+  return std::find(failedAssumptions.begin(), failedAssumptions.end(),
+                   literal) != failedAssumptions.end();
+}
+
+void cdclsolve::IncrementalSolver::interrupt() { solver.interrupt(); }
+
+void cdclsolve::IncrementalSolver::setBudget(const Solver::Budget &budget) {
+  solver.setBudget(budget);
+}
+
+const cdclsolve::Formula &cdclsolve::IncrementalSolver::getFormula() const {
+  return formula;
+}
+
+const cdclsolve::Solver &cdclsolve::IncrementalSolver::getSolver() const {
+  return solver;
+}
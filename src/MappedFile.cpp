@@ -0,0 +1,73 @@
+#include <cdclsolve/MappedFile.hpp>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+cdclsolve::MappedFile::MappedFile(const std::string &fileName) {
+  const int fileDescriptor{::open(fileName.c_str(), O_RDONLY)};
+  if (fileDescriptor < 0) {
+    throw std::runtime_error("cannot open input file '" + fileName +
+                             "': " + std::strerror(errno));
+  }
+  struct stat status {};
+  if (::fstat(fileDescriptor, &status) == 0 && S_ISREG(status.st_mode) &&
+      status.st_size > 0) {
+    const auto size{static_cast<std::size_t>(status.st_size)};
+    if (auto m{::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fileDescriptor,
+                      0)};
+        m != MAP_FAILED) {
+      ::madvise(m, size, MADV_SEQUENTIAL);
+      mapping = m;
+      mappingSize = size;
+    }
+  }
+  if (mapping == nullptr) {
+    readAll(fileDescriptor);
+  }
+  ::close(fileDescriptor);
+}
+
+cdclsolve::MappedFile::~MappedFile() {
+  if (mapping != nullptr) {
+    ::munmap(mapping, mappingSize);
+  }
+}
+
+const char *cdclsolve::MappedFile::begin() const {
+  return mapping != nullptr ? static_cast<const char *>(mapping)
+                            : buffer.data();
+}
+
+const char *cdclsolve::MappedFile::end() const { return begin() + size(); }
+
+std::size_t cdclsolve::MappedFile::size() const {
+  return mapping != nullptr ? mappingSize : buffer.size();
+}
+
+void cdclsolve::MappedFile::readAll(int fileDescriptor) {
+  std::size_t filled{0};
+  while (true) {
+    buffer.resize(filled + READ_BLOCK_SIZE);
+    const auto count{
+        ::read(fileDescriptor, buffer.data() + filled, READ_BLOCK_SIZE)};
+    if (count < 0 && errno == EINTR) {
+      continue;
+    }
+    if (count < 0) {
+      ::close(fileDescriptor);
+      throw std::runtime_error(std::string("cannot read input file: ") +
+                               std::strerror(errno));
+    }
+    if (count == 0) {
+      break;
+    }
+    filled += static_cast<std::size_t>(count);
+  }
+  buffer.resize(filled);
+}
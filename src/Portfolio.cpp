@@ -0,0 +1,123 @@
+#include <cdclsolve/Portfolio.hpp>
+
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+const std::vector<cdclsolve::Portfolio::Configuration>
+    cdclsolve::Portfolio::configurations{{"vsids", "luby", true},
+                                         {"vsids", "glucose", false},
+                                         {"dlis", "geometric", false},
+                                         {"vsids", "geometric", true},
+                                         {"jeroslowwang", "luby", false},
+                                         {"vsids", "none", false},
+                                         {"basic", "luby", true}};
+
+cdclsolve::Portfolio::Portfolio(Formula formula, std::size_t numberOfThreads,
+                                const std::string &decisionHeuristic,
+                                const std::string &restartStrategy,
+                                std::size_t shareSize, std::int32_t shareLbd)
+    : results(numberOfThreads, Solver::Result::UNKNOWN),
+      winner{numberOfThreads} {
+  if (numberOfThreads == 0) {
+    throw std::invalid_argument("portfolio needs at least one thread");
+  }
+  if (formula.hasProofWriter()) {
+    throw std::logic_error("proofs are not supported in portfolio mode");
+  }
+  formulas.reserve(numberOfThreads);
+  formulas.push_back(std::move(formula));
+  for (std::size_t i{1}; i < numberOfThreads; ++i) {
+    formulas.push_back(formulas.front());
+  }
+  if (numberOfThreads > 1 && shareSize > 0) {
+    clauseExchange = std::make_unique<ClauseExchange>(numberOfThreads,
+                                                      shareSize, shareLbd);
+    for (std::size_t i{0}; i < numberOfThreads; ++i) {
+      formulas[i].setClauseExchange(*clauseExchange, i);
+    }
+  }
+  solvers.push_back(std::make_unique<Solver>(formulas.front(),
+                                             decisionHeuristic,
+                                             restartStrategy));
+  for (std::size_t i{1}; i < numberOfThreads; ++i) {
+    const auto &configuration{
+        configurations[(i - 1) % configurations.size()]};
+    formulas[i].diversify(static_cast<std::uint32_t>(i),
+                          configuration.isPositivePhase);
+    solvers.push_back(std::make_unique<Solver>(
+        formulas[i], configuration.decisionHeuristic,
+        configuration.restartStrategy));
+  }
+}
+
+cdclsolve::Solver::Result cdclsolve::Portfolio::solve() {
+  std::vector<std::thread> threads;
+  for (std::size_t i{0}; i < solvers.size(); ++i) {
+    threads.emplace_back([this, i] {
+      results[i] = solvers[i]->solve();
+      auto expected{solvers.size()};
+      if (results[i] != Solver::Result::UNKNOWN &&
+          winner.compare_exchange_strong(expected, i)) {
+        interrupt();
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  return results[getWinner()];
+}
+
+void cdclsolve::Portfolio::interrupt() {
+  for (const auto &solver : solvers) {
+    solver->interrupt();
+  }
+}
+
+void cdclsolve::Portfolio::setBudget(const Solver::Budget &budget) {
+  for (const auto &solver : solvers) {
+    solver->setBudget(budget);
+  }
+}
+
+void cdclsolve::Portfolio::enableStatistics() {
+  for (const auto &solver : solvers) {
+    solver->enableStatistics();
+  }
+}
+
+void cdclsolve::Portfolio::setReporter(const Reporter &reporter,
+                                       std::uint64_t conflictInterval) {
+  for (std::size_t i{0}; i < solvers.size(); ++i) {
+    solvers[i]->setReporter(
+        [reporter, i](const Solver &solver, Solver::Report report) {
+          reporter(i, solver, report);
+        },
+        conflictInterval);
+  }
+}
+
+void cdclsolve::Portfolio::requestReport(Solver::Report report) {
+  for (const auto &solver : solvers) {
+    solver->requestReport(report);
+  }
+}
+
+const cdclsolve::Formula &cdclsolve::Portfolio::getFormula() const {
+  return formulas[getWinner()];
+}
+
+const cdclsolve::Solver &cdclsolve::Portfolio::getSolver() const {
+  return *solvers[getWinner()];
+}
+
+const std::vector<cdclsolve::Formula> &
+cdclsolve::Portfolio::getFormulas() const {
+  return formulas;
+}
+
+std::size_t cdclsolve::Portfolio::getWinner() const {
+  const auto index{winner.load()};
+  return index < solvers.size() ? index : 0;
+}
@@ -0,0 +1,350 @@
+#include <cdclsolve/Preprocessor.hpp>
+
+#include <cdclsolve/VariableStore.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <numeric>
+
+cdclsolve::Preprocessor::Preprocessor(std::int32_t numberOfVariables,
+                                      ProofWriter *proofWriter,
+                                      std::uint64_t nextClauseId)
+    : numberOfVariables{numberOfVariables}, proofWriter{proofWriter},
+      nextClauseId{nextClauseId},
+      occurrences(static_cast<std::size_t>(numberOfVariables) + 1),
+      marks(2 * static_cast<std::size_t>(numberOfVariables) + 2, 0),
+      isEliminated(static_cast<std::size_t>(numberOfVariables) + 1, 0) {}
+
+void cdclsolve::Preprocessor::reserve(std::size_t numberOfClauses,
+                                      std::size_t numberOfLiterals) {
+  clauses.reserve(numberOfClauses);
+  literals.reserve(numberOfLiterals);
+}
+
+void cdclsolve::Preprocessor::addClause(const std::int32_t *begin,
+                                        const std::int32_t *end,
+                                        std::uint64_t id) {
+  Clause clause{literals.size(), 0, id};
+  literals.insert(literals.end(), begin, end);
+  std::sort(literals.begin() + clause.begin, literals.end());
+  literals.erase(std::unique(literals.begin() + clause.begin, literals.end()),
+                 literals.end());
+  clause.size = literals.size() - clause.begin;
+  clause.signature = getSignature(clause);
+  const auto index{clauses.size()};
+  clauses.push_back(clause);
+  if (clause.size == 0) {
+    isUnsatisfiable = true;
+  }
+  const auto *first{this->begin(clause)};
+  const auto *last{this->end(clause)};
+  if (std::any_of(first, last, [first, last](std::int32_t l) {
+        return std::binary_search(first, last, -l);
+      })) {
+    removeClause(index);
+  }
+}
+
+bool cdclsolve::Preprocessor::preprocess() {
+  std::vector<std::size_t> counts(occurrences.size(), 0);
+  for (const auto &clause : clauses) {
+    for (auto *l{begin(clause)}; !clause.isDeleted && l != end(clause); ++l) {
+      ++counts[std::abs(*l)];
+    }
+  }
+  for (std::size_t v{0}; v < occurrences.size(); ++v) {
+    occurrences[v].reserve(counts[v]);
+  }
+  for (std::size_t c{0}; c < clauses.size(); ++c) {
+    for (auto *l{begin(clauses[c])};
+         !clauses[c].isDeleted && l != end(clauses[c]); ++l) {
+      occurrences[std::abs(*l)].push_back(c);
+    }
+  }
+  queue.resize(clauses.size());
+  std::iota(queue.begin(), queue.end(), 0);
+  std::sort(queue.begin(), queue.end(),
+            [this](std::size_t first, std::size_t second) {
+              return std::pair{clauses[first].size, first} >
+                     std::pair{clauses[second].size, second};
+            });
+  subsume();
+  if (!isUnsatisfiable) {
+    eliminate();
+  }
+  return !isUnsatisfiable;
+}
+
+const std::vector<cdclsolve::Preprocessor::Clause> &
+cdclsolve::Preprocessor::getClauses() const {
+  return clauses;
+}
+
+const std::int32_t *
+cdclsolve::Preprocessor::begin(const Clause &clause) const {
+  return literals.data() + clause.begin;
+}
+
+const std::int32_t *cdclsolve::Preprocessor::end(const Clause &clause) const {
+  return literals.data() + clause.begin + clause.size;
+}
+
+const std::vector<std::int32_t> &
+cdclsolve::Preprocessor::getEliminatedVariables() const {
+  return eliminatedVariables;
+}
+
+const std::vector<std::int32_t> &
+cdclsolve::Preprocessor::getReconstructionStack() const {
+  return reconstructionStack;
+}
+
+std::uint64_t cdclsolve::Preprocessor::getNextClauseId() const {
+  return nextClauseId;
+}
+
+bool cdclsolve::Preprocessor::hasLiteral(const Clause &clause,
+                                         std::int32_t literal) const {
+  return std::find(begin(clause), end(clause), literal) != end(clause);
+}
+
+void cdclsolve::Preprocessor::subsume() {
+  while (!queue.empty() && !isUnsatisfiable && steps < STEP_LIMIT) {
+    const auto index{queue.back()};
+    queue.pop_back();
+    const auto &subsuming{clauses[index]};
+    if (subsuming.isDeleted) {
+      continue;
+    }
+    auto best{std::abs(*begin(subsuming))};
+    for (auto *l{begin(subsuming)}; l != end(subsuming); ++l) {
+      if (occurrences[std::abs(*l)].size() < occurrences[best].size()) {
+        best = std::abs(*l);
+      }
+    }
+    auto &list{occurrences[best]};
+    steps += list.size();
+    for (std::size_t i{0}; i < list.size() && !isUnsatisfiable; ++i) {
+      const auto &clause{clauses[list[i]]};
+      if (list[i] == index || clause.isDeleted ||
+          clause.size < subsuming.size ||
+          (subsuming.signature & ~clause.signature) != 0) {
+        continue;
+      }
+      const auto literal{subsumes(subsuming, clause)};
+      if (literal == SUBSUMED) {
+        removeClause(list[i]);
+      } else if (literal != NOT_SUBSUMED) {
+        strengthen(list[i], -literal, subsuming.id);
+      }
+    }
+    list.erase(std::remove_if(list.begin(), list.end(),
+                              [this](std::size_t c) {
+                                return clauses[c].isDeleted;
+                              }),
+               list.end());
+  }
+}
+
+std::int32_t cdclsolve::Preprocessor::subsumes(const Clause &subsuming,
+                                               const Clause &subsumed) {
+  steps += subsuming.size + subsumed.size;
+  markLiterals(subsumed);
+  auto result{SUBSUMED};
+  for (auto *l{begin(subsuming)}; l != end(subsuming); ++l) {
+    if (isMarked(*l)) {
+      continue;
+    }
+    if (result == SUBSUMED && isMarked(-*l)) {
+      result = *l;
+      continue;
+    }
+    return NOT_SUBSUMED;
+  }
+  return result;
+}
+
+void cdclsolve::Preprocessor::strengthen(std::size_t index,
+                                         std::int32_t literal,
+                                         std::uint64_t antecedent) {
+  auto &clause{clauses[index]};
+  resolvent.assign(begin(clause), end(clause));
+  auto *first{literals.data() + clause.begin};
+  std::remove(first, first + clause.size, literal);
+  --clause.size;
+  const auto id{nextClauseId++};
+  if (proofWriter != nullptr) {
+    proofWriter->addClause(id, begin(clause), end(clause),
+                           {antecedent, clause.id});
+    proofWriter->deleteClause(clause.id, resolvent.data(),
+                              resolvent.data() + resolvent.size());
+  }
+  steps += clause.size;
+  clause.id = id;
+  clause.signature = getSignature(clause);
+  if (clause.size == 0) {
+    isUnsatisfiable = true;
+  } else {
+    queue.push_back(index);
+  }
+}
+
+void cdclsolve::Preprocessor::eliminate() {
+  std::vector<std::int32_t> candidates;
+  for (std::int32_t v{1}; v <= numberOfVariables; ++v) {
+    if (isEliminated[v] == 0) {
+      candidates.push_back(v);
+    }
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [this](std::int32_t first, std::int32_t second) {
+              return std::pair{occurrences[first].size(), first} <
+                     std::pair{occurrences[second].size(), second};
+            });
+  for (const auto v : candidates) {
+    if (isUnsatisfiable || steps >= STEP_LIMIT) {
+      break;
+    }
+    eliminate(v);
+    subsume();
+  }
+}
+
+void cdclsolve::Preprocessor::eliminate(std::int32_t variable) {
+  positive.clear();
+  negative.clear();
+  auto &list{occurrences[variable]};
+  std::size_t kept{0};
+  for (const auto c : list) {
+    const auto &clause{clauses[c]};
+    steps += clause.size;
+    if (clause.isDeleted) {
+      continue;
+    }
+    if (hasLiteral(clause, variable)) {
+      positive.push_back(c);
+    } else if (hasLiteral(clause, -variable)) {
+      negative.push_back(c);
+    } else {
+      continue;
+    }
+    list[kept++] = c;
+  }
+  list.resize(kept);
+  const auto limit{positive.size() + negative.size()};
+  if (limit > MAX_OCCURRENCES) {
+    return;
+  }
+  resolvents.clear();
+  resolventEnds.clear();
+  antecedents.clear();
+  for (const auto p : positive) {
+    for (const auto n : negative) {
+      if (!resolve(clauses[p], clauses[n], variable)) {
+        continue;
+      }
+      if (resolvent.size() > MAX_RESOLVENT_SIZE ||
+          resolventEnds.size() == limit) {
+        return;
+      }
+      resolvents.insert(resolvents.end(), resolvent.begin(), resolvent.end());
+      resolventEnds.push_back(resolvents.size());
+      antecedents.emplace_back(clauses[p].id, clauses[n].id);
+    }
+  }
+  for (std::size_t i{0}; i < resolventEnds.size(); ++i) {
+    addResolvent(resolvents.data() + (i == 0 ? 0 : resolventEnds[i - 1]),
+                 resolvents.data() + resolventEnds[i], antecedents[i]);
+  }
+  for (const auto &[side, witness] :
+       {std::pair{&positive, variable}, std::pair{&negative, -variable}}) {
+    for (const auto c : *side) {
+      reconstructionStack.push_back(witness);
+      for (auto *l{begin(clauses[c])}; l != end(clauses[c]); ++l) {
+        if (*l != witness) {
+          reconstructionStack.push_back(*l);
+        }
+      }
+      reconstructionStack.push_back(
+          static_cast<std::int32_t>(clauses[c].size));
+      removeClause(c);
+    }
+  }
+  list.clear();
+  isEliminated[variable] = 1;
+  eliminatedVariables.push_back(variable);
+}
+
+bool cdclsolve::Preprocessor::resolve(const Clause &first,
+                                      const Clause &second,
+                                      std::int32_t variable) {
+  steps += first.size + second.size;
+  markLiterals(first);
+  resolvent.clear();
+  for (auto *l{begin(first)}; l != end(first); ++l) {
+    if (*l != variable) {
+      resolvent.push_back(*l);
+    }
+  }
+  for (auto *l{begin(second)}; l != end(second); ++l) {
+    if (*l == -variable || isMarked(*l)) {
+      continue;
+    }
+    if (isMarked(-*l)) {
+      return false;
+    }
+    resolvent.push_back(*l);
+  }
+  return true;
+}
+
+void cdclsolve::Preprocessor::addResolvent(
+    const std::int32_t *begin, const std::int32_t *end,
+    std::pair<std::uint64_t, std::uint64_t> antecedents) {
+  const auto index{clauses.size()};
+  Clause clause{literals.size(), static_cast<std::size_t>(end - begin),
+                nextClauseId++};
+  literals.insert(literals.end(), begin, end);
+  clause.signature = getSignature(clause);
+  clauses.push_back(clause);
+  if (proofWriter != nullptr) {
+    proofWriter->addClause(clause.id, this->begin(clause), this->end(clause),
+                           {antecedents.first, antecedents.second});
+  }
+  for (auto *l{this->begin(clause)}; l != this->end(clause); ++l) {
+    occurrences[std::abs(*l)].push_back(index);
+  }
+  if (clause.size == 0) {
+    isUnsatisfiable = true;
+  } else {
+    queue.push_back(index);
+  }
+}
+
+void cdclsolve::Preprocessor::removeClause(std::size_t index) {
+  auto &clause{clauses[index]};
+  clause.isDeleted = true;
+  if (proofWriter != nullptr) {
+    proofWriter->deleteClause(clause.id, begin(clause), end(clause));
+  }
+}
+
+void cdclsolve::Preprocessor::markLiterals(const Clause &clause) {
+  ++mark;
+  for (auto *l{begin(clause)}; l != end(clause); ++l) {
+    marks[VariableStore::getLiteralIndex(*l)] = mark;
+  }
+}
+
+bool cdclsolve::Preprocessor::isMarked(std::int32_t literal) const {
+  return marks[VariableStore::getLiteralIndex(literal)] == mark;
+}
+
+std::uint64_t
+cdclsolve::Preprocessor::getSignature(const Clause &clause) const {
+  std::uint64_t signature{0};
+  for (auto *l{begin(clause)}; l != end(clause); ++l) {
+    signature |= std::uint64_t{1} << (std::abs(*l) & 63);
+  }
+  return signature;
+}
@@ -0,0 +1,137 @@
+#include <cdclsolve/ProofWriter.hpp>
+
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+
+const std::map<std::string, cdclsolve::ProofWriter::Format>
+    cdclsolve::ProofWriter::formatMap{{"drat", Format::DRAT},
+                                      {"binary-drat", Format::BINARY_DRAT},
+                                      {"lrat", Format::LRAT}};
+
+cdclsolve::ProofWriter::ProofWriter(const std::string &fileName,
+                                    const std::string &format)
+    : format{formatMap.at(format)}, to{fileName, std::ios::binary},
+      queue{QUEUE_SIZE} {
+  if (!to.is_open()) {
+    throw std::runtime_error("cannot open proof file '" + fileName + "'");
+  }
+  writer = std::thread{&ProofWriter::run, this};
+}
+
+cdclsolve::ProofWriter::~ProofWriter() {
+  isClosed.store(true, std::memory_order_release);
+  writer.join();
+}
+
+bool cdclsolve::ProofWriter::hasHints() const {
+  return format == Format::LRAT;
+}
+
+void cdclsolve::ProofWriter::addClause(
+    std::uint64_t id, const std::int32_t *begin, const std::int32_t *end,
+    const std::vector<std::uint64_t> &hints) {
+  record.clear();
+  if (format == Format::BINARY_DRAT) {
+    record.push_back(BINARY_ADD);
+    for (auto l{begin}; l != end; ++l) {
+      appendBinary(*l);
+    }
+    record.push_back(0);
+  } else {
+    if (format == Format::LRAT) {
+      append(static_cast<std::int64_t>(id));
+      append(' ');
+    }
+    appendLiterals(begin, end);
+    if (format == Format::LRAT) {
+      for (const auto hint : hints) {
+        append(static_cast<std::int64_t>(hint));
+        append(' ');
+      }
+      append('0');
+      append('\n');
+    }
+  }
+  lastId = id;
+  push();
+}
+
+void cdclsolve::ProofWriter::deleteClause(std::uint64_t id,
+                                          const std::int32_t *begin,
+                                          const std::int32_t *end) {
+  record.clear();
+  if (format == Format::BINARY_DRAT) {
+    record.push_back(BINARY_DELETE);
+    for (auto l{begin}; l != end; ++l) {
+      appendBinary(*l);
+    }
+    record.push_back(0);
+  } else if (format == Format::LRAT) {
+    append(static_cast<std::int64_t>(lastId));
+    append(' ');
+    append('d');
+    append(' ');
+    append(static_cast<std::int64_t>(id));
+    append(' ');
+    append('0');
+    append('\n');
+  } else {
+    append('d');
+    append(' ');
+    appendLiterals(begin, end);
+  }
+  push();
+}
+
+void cdclsolve::ProofWriter::appendLiterals(const std::int32_t *begin,
+                                            const std::int32_t *end) {
+  for (auto l{begin}; l != end; ++l) {
+    append(static_cast<std::int64_t>(*l));
+    append(' ');
+  }
+  append('0');
+  append(format == Format::LRAT ? ' ' : '\n');
+}
+
+void cdclsolve::ProofWriter::append(char c) { record.push_back(c); }
+
+void cdclsolve::ProofWriter::append(std::int64_t integer) {
+  const auto size{record.size()};
+  record.resize(size + MAX_INTEGER_LENGTH);
+  const auto end{std::to_chars(record.data() + size,
+                               record.data() + record.size(), integer)
+                     .ptr};
+  record.resize(static_cast<std::size_t>(end - record.data()));
+}
+
+void cdclsolve::ProofWriter::appendBinary(std::int32_t literal) {
+  auto encoded{2 * static_cast<std::uint32_t>(std::abs(literal)) +
+               (literal < 0 ? 1 : 0)};
+  while (encoded > 0x7f) {
+    record.push_back(static_cast<char>((encoded & 0x7f) | 0x80));
+    encoded >>= 7;
+  }
+  record.push_back(static_cast<char>(encoded));
+}
+
+void cdclsolve::ProofWriter::push() {
+  queue.push(record.data(), record.size());
+}
+
+void cdclsolve::ProofWriter::run() {
+  std::vector<char> chunk(WRITE_SIZE);
+  while (true) {
+    const auto isLast{isClosed.load(std::memory_order_acquire)};
+    std::size_t size{0};
+    while ((size = queue.pop(chunk.data(), chunk.size())) > 0) {
+      to.write(chunk.data(), static_cast<std::streamsize>(size));
+    }
+    if (isLast) {
+      break;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(IDLE_MICROSECONDS));
+  }
+  to.flush();
+}
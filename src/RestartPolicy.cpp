@@ -0,0 +1,85 @@
+#include <cdclsolve/RestartPolicy.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+cdclsolve::RestartPolicy::RestartPolicy(const std::string &strategy)
+    : strategy{strategyMap.at(strategy)} {
+  updateRestartInterval();
+}
+
+void cdclsolve::RestartPolicy::registerConflict(std::int32_t lbd) {
+  ++conflicts;
+  ++conflictsSinceRestart;
+  if (strategy != Strategy::GLUCOSE) {
+    return;
+  }
+  fastLbdAverage += std::max(FAST_EMA_ALPHA, 1.0 / conflicts) *
+                    (lbd - fastLbdAverage);
+  slowLbdAverage += std::max(SLOW_EMA_ALPHA, 1.0 / conflicts) *
+                    (lbd - slowLbdAverage);
+}
+
+bool cdclsolve::RestartPolicy::isRestartDue() const {
+  switch (strategy) {
+  case Strategy::NONE:
+    return false;
+  case Strategy::GLUCOSE:
+    return conflictsSinceRestart >= GLUCOSE_MIN_CONFLICTS &&
+           fastLbdAverage > GLUCOSE_MARGIN * slowLbdAverage;
+  default:
+    return conflictsSinceRestart >= restartInterval;
+  }
+}
+
+void cdclsolve::RestartPolicy::restart() {
+  ++restarts;
+  conflictsSinceRestart = 0;
+  updateRestartInterval();
+}
+
+std::uint64_t cdclsolve::RestartPolicy::getRestarts() const {
+  return restarts;
+}
+
+std::uint64_t cdclsolve::RestartPolicy::getRestartInterval() const {
+  return restartInterval;
+}
+
+const std::map<std::string, cdclsolve::RestartPolicy::Strategy>
+    cdclsolve::RestartPolicy::strategyMap{{"none", Strategy::NONE},
+                                          {"luby", Strategy::LUBY},
+                                          {"geometric", Strategy::GEOMETRIC},
+                                          {"glucose", Strategy::GLUCOSE}};
+
+std::uint64_t cdclsolve::RestartPolicy::luby(std::uint64_t index) {
+  std::uint64_t size{1};
+  std::uint64_t sequence{0};
+  while (size < index + 1) {
+    ++sequence;
+    size = 2 * size + 1;
+  }
+  while (size - 1 != index) {
+    size = (size - 1) / 2;
+    --sequence;
+    index %= size;
+  }
+  return std::uint64_t{1} << sequence;
+}
+
+void cdclsolve::RestartPolicy::updateRestartInterval() {
+  switch (strategy) {
+  case Strategy::LUBY:
+    restartInterval = LUBY_UNIT * luby(restarts);
+    break;
+  case Strategy::GEOMETRIC:
+    restartInterval = static_cast<std::uint64_t>(
+        GEOMETRIC_FIRST * std::pow(GEOMETRIC_FACTOR, restarts));
+    break;
+  case Strategy::GLUCOSE:
+    restartInterval = GLUCOSE_MIN_CONFLICTS;
+    break;
+  default:
+    restartInterval = 0;
+  }
+}
@@ -0,0 +1,38 @@
+#include <cdclsolve/RingBuffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+cdclsolve::RingBuffer::RingBuffer(std::size_t capacity)
+    : buffer(capacity), mask{capacity - 1} {
+  if (capacity == 0 || (capacity & mask) != 0) {
+    throw std::invalid_argument("ring buffer capacity must be a power of two");
+  }
+}
+
+void cdclsolve::RingBuffer::push(const char *data, std::size_t size) {
+  while (size > 0) {
+    const auto t{tail.load(std::memory_order_relaxed)};
+    const auto free{buffer.size() - (t - head.load(std::memory_order_acquire))};
+    if (free == 0) {
+      std::this_thread::yield();
+      continue;
+    }
+    const auto count{std::min({size, free, buffer.size() - (t & mask)})};
+    std::memcpy(buffer.data() + (t & mask), data, count);
+    tail.store(t + count, std::memory_order_release);
+    data += count;
+    size -= count;
+  }
+}
+
+std::size_t cdclsolve::RingBuffer::pop(char *data, std::size_t size) {
+  const auto h{head.load(std::memory_order_relaxed)};
+  const auto count{std::min({size, tail.load(std::memory_order_acquire) - h,
+                             buffer.size() - (h & mask)})};
+  std::memcpy(data, buffer.data() + (h & mask), count);
+  head.store(h + count, std::memory_order_release);
+  return count;
+}
@@ -0,0 +1,95 @@
+#include <cdclsolve/ScoreHeap.hpp>
+
+cdclsolve::ScoreHeap::ScoreHeap(std::size_t size)
+    : scores(size, 0.0), positions(size, NOT_IN_HEAP) {}
+
+void cdclsolve::ScoreHeap::resize(std::size_t size) {
+  scores.resize(size, 0.0);
+  positions.resize(size, NOT_IN_HEAP);
+}
+
+std::size_t cdclsolve::ScoreHeap::getSize() const { return scores.size(); }
+
+double cdclsolve::ScoreHeap::getScore(std::size_t index) const {
+  return scores[index];
+}
+
+void cdclsolve::ScoreHeap::setScore(std::size_t index, double score) {
+  const auto previous{scores[index]};
+  scores[index] = score;
+  if (positions[index] == NOT_IN_HEAP) {
+    return;
+  }
+  if (score > previous) {
+    siftUp(positions[index]);
+  } else {
+    siftDown(positions[index]);
+  }
+}
+
+void cdclsolve::ScoreHeap::scale(double factor) {
+  for (auto &s : scores) {
+    s *= factor;
+  }
+}
+
+void cdclsolve::ScoreHeap::insert(std::size_t index) {
+  if (positions[index] != NOT_IN_HEAP) {
+    return;
+  }
+  positions[index] = heap.size();
+  heap.push_back(index);
+  siftUp(heap.size() - 1);
+}
+
+bool cdclsolve::ScoreHeap::contains(std::size_t index) const {
+  return positions[index] != NOT_IN_HEAP;
+}
+
+bool cdclsolve::ScoreHeap::isEmpty() const { return heap.empty(); }
+
+std::size_t cdclsolve::ScoreHeap::removeMax() {
+  const auto index{heap.front()};
+  positions[index] = NOT_IN_HEAP;
+  heap.front() = heap.back();
+  heap.pop_back();
+  if (!heap.empty()) {
+    positions[heap.front()] = 0;
+    siftDown(0);
+  }
+  return index;
+}
+
+void cdclsolve::ScoreHeap::siftUp(std::size_t position) {
+  const auto index{heap[position]};
+  while (position > 0) {
+    const auto parent{(position - 1) / 2};
+    if (scores[heap[parent]] >= scores[index]) {
+      break;
+    }
+    heap[position] = heap[parent];
+    positions[heap[position]] = position;
+    position = parent;
+  }
+  heap[position] = index;
+  positions[index] = position;
+}
+
+void cdclsolve::ScoreHeap::siftDown(std::size_t position) {
+  const auto index{heap[position]};
+  while (2 * position + 1 < heap.size()) {
+    auto child{2 * position + 1};
+    if (child + 1 < heap.size() &&
+        scores[heap[child + 1]] > scores[heap[child]]) {
+      ++child;
+    }
+    if (scores[heap[child]] <= scores[index]) {
+      break;
+    }
+    heap[position] = heap[child];
+    positions[heap[position]] = position;
+    position = child;
+  }
+  heap[position] = index;
+  positions[index] = position;
+}
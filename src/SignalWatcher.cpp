@@ -0,0 +1,100 @@
+#include <cdclsolve/SignalWatcher.hpp>
+
+#include <pthread.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <utility>
+
+cdclsolve::SignalWatcher::SignalWatcher(
+    std::chrono::steady_clock::duration timerInterval)
+    : timerInterval{timerInterval} {
+  sigemptyset(&signals);
+  sigaddset(&signals, SIGINT);
+  sigaddset(&signals, SIGTERM);
+  sigaddset(&signals, SIGUSR1);
+  pthread_sigmask(SIG_BLOCK, &signals, &previousSignals);
+  thread = std::thread{[this] { watch(); }};
+}
+
+cdclsolve::SignalWatcher::~SignalWatcher() {
+  {
+    std::lock_guard<std::mutex> lock{mutex};
+    isStopped = true;
+  }
+  pthread_kill(thread.native_handle(), SIGTERM);
+  thread.join();
+  pthread_sigmask(SIG_SETMASK, &previousSignals, nullptr);
+}
+
+void cdclsolve::SignalWatcher::setHandler(std::function<void()> handler) {
+  std::lock_guard<std::mutex> lock{mutex};
+  this->handler = std::move(handler);
+  if (isSignaled && this->handler) {
+    this->handler();
+  }
+}
+
+void cdclsolve::SignalWatcher::setDumpHandler(std::function<void()> handler) {
+  std::lock_guard<std::mutex> lock{mutex};
+  dumpHandler = std::move(handler);
+}
+
+void cdclsolve::SignalWatcher::setTimerHandler(std::function<void()> handler) {
+  std::lock_guard<std::mutex> lock{mutex};
+  timerHandler = std::move(handler);
+}
+
+void cdclsolve::SignalWatcher::watch() {
+  auto deadline{std::chrono::steady_clock::now() + timerInterval};
+  while (true) {
+    const auto signal{waitForSignal(deadline)};
+    std::lock_guard<std::mutex> lock{mutex};
+    if (isStopped) {
+      return;
+    }
+    if (signal <= 0) {
+      const auto now{std::chrono::steady_clock::now()};
+      if (now >= deadline) {
+        deadline = now + timerInterval;
+        if (timerHandler) {
+          timerHandler();
+        }
+      }
+      continue;
+    }
+    if (signal == SIGUSR1) {
+      if (dumpHandler) {
+        dumpHandler();
+      }
+      continue;
+    }
+    if (isSignaled) {
+      std::_Exit(128 + signal);
+    }
+    isSignaled = true;
+    if (handler) {
+      handler();
+    }
+  }
+}
+
+int cdclsolve::SignalWatcher::waitForSignal(
+    std::chrono::steady_clock::time_point deadline) {
+  if (timerInterval == std::chrono::steady_clock::duration::zero()) {
+    int signal{0};
+    return sigwait(&signals, &signal) == 0 ? signal : 0;
+  }
+  const auto timeout{std::max(deadline - std::chrono::steady_clock::now(),
+                              std::chrono::steady_clock::duration::zero())};
+  const auto seconds{
+      std::chrono::duration_cast<std::chrono::seconds>(timeout)};
+  const timespec time{
+      static_cast<std::time_t>(seconds.count()),
+      static_cast<long>(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(timeout -
+                                                               seconds)
+              .count())};
+  return sigtimedwait(&signals, nullptr, &time);
+}
@@ -0,0 +1,110 @@
+#include <cdclsolve/SolutionWriter.hpp>
+
+#include <charconv>
+#include <cstring>
+
+const std::map<std::string, cdclsolve::SolutionWriter::Format>
+    cdclsolve::SolutionWriter::formatMap{{"qdimacs", Format::QDIMACS},
+                                         {"competition", Format::COMPETITION}};
+
+cdclsolve::SolutionWriter::SolutionWriter(std::ostream &to,
+                                          const std::string &format)
+    : to{to}, format{formatMap.at(format)}, buffer(BUFFER_SIZE) {}
+
+void cdclsolve::SolutionWriter::write(const Formula &formula,
+                                      Solver::Result result) {
+  if (format == Format::QDIMACS) {
+    writeQdimacs(formula, result);
+  } else {
+    writeCompetition(formula, result);
+  }
+  flush();
+  to.flush();
+}
+
+void cdclsolve::SolutionWriter::writeQdimacs(const Formula &formula,
+                                             Solver::Result result) {
+  const auto &variables{formula.getVariables()};
+  append(SOLUTION_LINE_S);
+  append(' ');
+  append(SOLUTION_LINE_CNF);
+  append(' ');
+  append(result == Solver::Result::SAT     ? 1
+         : result == Solver::Result::UNSAT ? -1
+                                           : 0);
+  append(' ');
+  append(variables.getNumberOfVariables());
+  append(' ');
+  append(formula.getNumberOfClauses());
+  append('\n');
+  if (result != Solver::Result::SAT) {
+    return;
+  }
+  for (std::int32_t v{1}; v <= variables.getNumberOfVariables(); ++v) {
+    if (variables.isAssigned(v)) {
+      append(CERT_LINE_V);
+      append(' ');
+      append(variables.isTrue(v) ? v : -v);
+      append('\n');
+    }
+  }
+}
+
+void cdclsolve::SolutionWriter::writeCompetition(const Formula &formula,
+                                                 Solver::Result result) {
+  const auto &variables{formula.getVariables()};
+  append(SOLUTION_LINE_S);
+  append(' ');
+  append(result == Solver::Result::SAT     ? SOLUTION_SATISFIABLE
+         : result == Solver::Result::UNSAT ? SOLUTION_UNSATISFIABLE
+                                           : SOLUTION_UNKNOWN);
+  append('\n');
+  if (result != Solver::Result::SAT) {
+    return;
+  }
+  append(VALUE_LINE_V);
+  auto lineLength{VALUE_LINE_V.size()};
+  for (std::int32_t v{1}; v <= variables.getNumberOfVariables(); ++v) {
+    if (lineLength + 1 + MAX_INTEGER_LENGTH > VALUE_LINE_LENGTH) {
+      append('\n');
+      append(VALUE_LINE_V);
+      lineLength = VALUE_LINE_V.size();
+    }
+    append(' ');
+    lineLength += 1 + append(variables.isTrue(v) ? v : -v);
+  }
+  append(' ');
+  append(0);
+  append('\n');
+}
+
+void cdclsolve::SolutionWriter::append(std::string_view text) {
+  if (size + text.size() > buffer.size()) {
+    flush();
+  }
+  std::memcpy(buffer.data() + size, text.data(), text.size());
+  size += text.size();
+}
+
+void cdclsolve::SolutionWriter::append(char c) {
+  if (size == buffer.size()) {
+    flush();
+  }
+  buffer[size++] = c;
+}
+
+std::size_t cdclsolve::SolutionWriter::append(std::int32_t integer) {
+  if (size + MAX_INTEGER_LENGTH > buffer.size()) {
+    flush();
+  }
+  const auto begin{buffer.data() + size};
+  const auto end{
+      std::to_chars(begin, buffer.data() + buffer.size(), integer).ptr};
+  size += static_cast<std::size_t>(end - begin);
+  return static_cast<std::size_t>(end - begin);
+}
+
+void cdclsolve::SolutionWriter::flush() {
+  to.write(buffer.data(), static_cast<std::streamsize>(size));
+  size = 0;
+}
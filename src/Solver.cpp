@@ -1,83 +1,104 @@
 #include <cdclsolve/Solver.hpp>
 
+#include <sys/resource.h>
+
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
 cdclsolve::Solver::Solver(Formula &formula,
-                          const std::string &decisionHeuristic)
-    : decide{decisionHeuristicMap.at(decisionHeuristic)}, formula{formula} {}
+                          const std::string &decisionHeuristic,
+                          const std::string &restartStrategy)
+    : decide{decisionHeuristicMap.at(decisionHeuristic)}, formula{formula},
+      restartPolicy{restartStrategy} {}
 
-cdclsolve::Solver::Result cdclsolve::Solver::solve() {
-  std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+cdclsolve::Solver::Result cdclsolve::Solver::solve() { return solve({}); }
+
+cdclsolve::Solver::Result
+cdclsolve::Solver::solve(const std::vector<std::int32_t> &assumptions) {
+  for (const auto literal : assumptions) {
+    if (formula.isEliminated(std::abs(literal))) {
+      throw std::logic_error("assumption on eliminated variable: " +
+                             std::to_string(literal));
+    }
+  }
+  solveStart = std::chrono::steady_clock::now();
+  solveStartCpu = Statistics::ThreadClock::now();
+  this->assumptions = assumptions;
+  failedAssumptions.clear();
+  budgetConflicts = formula.getConflicts() + budget.conflicts;
+  budgetPropagations = formula.getPropagations() + budget.propagations;
+  budgetDeadline = solveStart + budget.time;
+  if (decisionLevel != 0) {
+    doRestart();
+  }
   auto result{doSolve()};
-  durationTotal = std::chrono::steady_clock::now() - start;
+  durationTotal += std::chrono::steady_clock::now() - solveStart;
+  durationCpu += Statistics::ThreadClock::now() - solveStartCpu;
+  solveStart = {};
+  solveStartCpu = {};
   return result;
 }
 
-std::chrono::steady_clock::duration
-cdclsolve::Solver::getDurationBooleanConstraintPropagation() const {
-  return durationBooleanConstraintPropagation;
+void cdclsolve::Solver::interrupt() {
+  isInterrupted.store(true, std::memory_order_relaxed);
 }
 
-double
-cdclsolve::Solver::getRelativeDurationBooleanConstraintPropagation() const {
-  if (durationTotal == std::chrono::steady_clock::duration::zero()) {
-    return 0.0;
-  }
-  return std::chrono::duration_cast<
-             std::chrono::duration<double, std::chrono::steady_clock::period>>(
-             durationBooleanConstraintPropagation) /
-         std::chrono::duration_cast<
-             std::chrono::duration<double, std::chrono::steady_clock::period>>(
-             durationTotal);
+void cdclsolve::Solver::setBudget(const Budget &budget) {
+  this->budget = budget;
 }
 
-std::chrono::steady_clock::duration
-cdclsolve::Solver::getDurationConflictResolution() const {
-  return durationConflictResolution;
+void cdclsolve::Solver::setReporter(Reporter reporter,
+                                    std::uint64_t conflictInterval) {
+  this->reporter = std::move(reporter);
+  reportInterval = conflictInterval;
+  nextReport = this->reporter && conflictInterval != 0
+                   ? formula.getConflicts() + conflictInterval
+                   : NO_REPORT;
 }
 
-double cdclsolve::Solver::getRelativeDurationConflictResolution() const {
-  if (durationTotal == std::chrono::steady_clock::duration::zero()) {
-    return 0.0;
-  }
-  return std::chrono::duration_cast<
-             std::chrono::duration<double, std::chrono::steady_clock::period>>(
-             durationConflictResolution) /
-         std::chrono::duration_cast<
-             std::chrono::duration<double, std::chrono::steady_clock::period>>(
-             durationTotal);
+void cdclsolve::Solver::requestReport(Report report) {
+  reportRequests.fetch_or(1u << static_cast<std::uint32_t>(report),
+                          std::memory_order_relaxed);
 }
 
-std::chrono::steady_clock::duration
-cdclsolve::Solver::getDurationDecision() const {
-  return durationDecision;
+const std::vector<std::int32_t> &
+cdclsolve::Solver::getFailedAssumptions() const {
+  return failedAssumptions;
 }
 
-double cdclsolve::Solver::getRelativeDurationDecision() const {
-  if (durationTotal == std::chrono::steady_clock::duration::zero()) {
-    return 0.0;
-  }
-  return std::chrono::duration_cast<
-             std::chrono::duration<double, std::chrono::steady_clock::period>>(
-             durationDecision) /
-         std::chrono::duration_cast<
-             std::chrono::duration<double, std::chrono::steady_clock::period>>(
-             durationTotal);
+void cdclsolve::Solver::enableStatistics() { isStatisticsEnabled = true; }
+
+const cdclsolve::Statistics &cdclsolve::Solver::getStatistics() const {
+  return statistics;
+}
+
+const cdclsolve::Formula &cdclsolve::Solver::getFormula() const {
+  return formula;
+}
+
+std::uint64_t cdclsolve::Solver::getRestarts() const {
+  return restartPolicy.getRestarts();
+}
+
+std::uint64_t cdclsolve::Solver::getRestartInterval() const {
+  return restartPolicy.getRestartInterval();
 }
 
 std::chrono::steady_clock::duration
 cdclsolve::Solver::getDurationTotal() const {
+  if (solveStart != std::chrono::steady_clock::time_point{}) {
+    return durationTotal + (std::chrono::steady_clock::now() - solveStart);
+  }
   return durationTotal;
 }
 
-double cdclsolve::Solver::getRelativeDurationTotal() const {
-  if (durationTotal == std::chrono::steady_clock::duration::zero()) {
-    return 0.0;
+std::chrono::steady_clock::duration cdclsolve::Solver::getDurationCpu() const {
+  if (solveStartCpu != Statistics::ThreadClock::time_point{}) {
+    return durationCpu + (Statistics::ThreadClock::now() - solveStartCpu);
   }
-  return std::chrono::duration_cast<
-             std::chrono::duration<double, std::chrono::steady_clock::period>>(
-             durationTotal) /
-         std::chrono::duration_cast<
-             std::chrono::duration<double, std::chrono::steady_clock::period>>(
-             durationTotal);
+  return durationCpu;
 }
 
 const std::map<std::string, cdclsolve::Solver::decisionFunction>
@@ -92,39 +113,154 @@ const std::map<std::string, cdclsolve::Solver::decisionFunction>
 cdclsolve::Solver::Result cdclsolve::Solver::doSolve() {
   doBooleanConstraintPropagation();
   if (formula.hasConflict()) {
+    doConflictResolution();
     return Result::UNSAT;
   }
   while (formula.hasFreeLiterals()) {
-    doDecision();
+    if (isInterrupted.exchange(false, std::memory_order_relaxed) ||
+        isBudgetExhausted()) {
+      return Result::UNKNOWN;
+    }
+    if (reportRequests.load(std::memory_order_relaxed) != 0 ||
+        formula.getConflicts() >= nextReport) {
+      doReport();
+    }
+    if (restartPolicy.isRestartDue()) {
+      doRestart();
+    }
+    if (decisionLevel == 0 && formula.importClauses()) {
+      doBooleanConstraintPropagation();
+      if (formula.hasConflict()) {
+        doConflictResolution();
+        return Result::UNSAT;
+      }
+      continue;
+    }
+    if (static_cast<std::size_t>(decisionLevel) < assumptions.size()) {
+      if (!doAssumption()) {
+        return Result::UNSAT;
+      }
+    } else {
+      doDecision();
+    }
     doBooleanConstraintPropagation();
     while (formula.hasConflict()) {
       doConflictResolution();
       if (formula.hasConflict()) {
         return Result::UNSAT;
       }
+      restartPolicy.registerConflict(formula.getLearnedClauseLbd());
       doBooleanConstraintPropagation();
     }
   }
+  for (const auto literal : assumptions) {
+    if (formula.getVariables().isFalse(literal)) {
+      failedAssumptions = formula.analyzeAssumption(literal);
+      return Result::UNSAT;
+    }
+  }
+  formula.reconstructModel();
   return Result::SAT;
 }
 
+bool cdclsolve::Solver::isBudgetExhausted() {
+  if ((budget.conflicts != 0 && formula.getConflicts() >= budgetConflicts) ||
+      (budget.propagations != 0 &&
+       formula.getPropagations() >= budgetPropagations)) {
+    return true;
+  }
+  if ((budget.time == std::chrono::steady_clock::duration::zero() &&
+       budget.memory == 0) ||
+      ++budgetChecks % BUDGET_CHECK_INTERVAL != 0) {
+    return false;
+  }
+  if (budget.time != std::chrono::steady_clock::duration::zero() &&
+      std::chrono::steady_clock::now() >= budgetDeadline) {
+    return true;
+  }
+  rusage usage{};
+  return budget.memory != 0 && getrusage(RUSAGE_SELF, &usage) == 0 &&
+         static_cast<std::size_t>(usage.ru_maxrss) * 1024 >= budget.memory;
+}
+
+void cdclsolve::Solver::doReport() {
+  auto requests{reportRequests.exchange(0, std::memory_order_relaxed)};
+  if (formula.getConflicts() >= nextReport) {
+    nextReport = formula.getConflicts() + reportInterval;
+    requests |= 1u << static_cast<std::uint32_t>(Report::PROGRESS);
+  }
+  if (!reporter) {
+    return;
+  }
+  for (const auto report : {Report::PROGRESS, Report::STATISTICS}) {
+    if ((requests & 1u << static_cast<std::uint32_t>(report)) != 0) {
+      reporter(*this, report);
+    }
+  }
+}
+
 void cdclsolve::Solver::doBooleanConstraintPropagation() {
-  std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+  const auto start{startSample(Statistics::Phase::PROPAGATION)};
   formula.propagateUnitLiterals(decisionLevel);
-  durationBooleanConstraintPropagation +=
-      std::chrono::steady_clock::now() - start;
+  stopSample(Statistics::Phase::PROPAGATION, start);
 }
 
 void cdclsolve::Solver::doDecision() {
-  std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+  const auto start{startSample(Statistics::Phase::DECISION)};
   auto literal{decide(formula)};
   ++decisionLevel;
   formula.assign(literal, decisionLevel);
-  durationDecision += std::chrono::steady_clock::now() - start;
+  stopSample(Statistics::Phase::DECISION, start);
+  if (isStatisticsEnabled) {
+    statistics.addDecision();
+  }
+}
+
+bool cdclsolve::Solver::doAssumption() {
+  const auto literal{assumptions[decisionLevel]};
+  if (formula.getVariables().isFalse(literal)) {
+    failedAssumptions = formula.analyzeAssumption(literal);
+    return false;
+  }
+  ++decisionLevel;
+  if (formula.getVariables().isTrue(literal)) {
+    formula.addDecisionLevel();
+  } else {
+    formula.assign(literal, decisionLevel);
+  }
+  return true;
 }
 
 void cdclsolve::Solver::doConflictResolution() {
-  std::chrono::steady_clock::time_point start{std::chrono::steady_clock::now()};
+  const auto phase{formula.isReductionDue()
+                        ? Statistics::Phase::REDUCTION
+                        : Statistics::Phase::CONFLICT_RESOLUTION};
+  const auto start{startSample(phase)};
+  const auto conflictLevel{decisionLevel};
   decisionLevel = formula.resolveConflict(decisionLevel);
-  durationConflictResolution += std::chrono::steady_clock::now() - start;
+  stopSample(phase, start);
+  if (isStatisticsEnabled && decisionLevel >= 0) {
+    statistics.addConflict(formula.getLearnedClauseSize(),
+                           formula.getLearnedClauseLbd(),
+                           conflictLevel - decisionLevel);
+  }
+}
+
+void cdclsolve::Solver::doRestart() {
+  formula.restart();
+  decisionLevel = 0;
+  restartPolicy.restart();
+}
+
+cdclsolve::Statistics::ThreadClock::time_point
+cdclsolve::Solver::startSample(Statistics::Phase phase) {
+  return isStatisticsEnabled ? statistics.startSample(phase)
+                             : Statistics::ThreadClock::time_point{};
+}
+
+void cdclsolve::Solver::stopSample(
+    Statistics::Phase phase, Statistics::ThreadClock::time_point start) {
+  if (isStatisticsEnabled) {
+    statistics.stopSample(phase, start);
+  }
 }
@@ -0,0 +1,83 @@
+#include <cdclsolve/Statistics.hpp>
+
+#include <time.h>
+
+void cdclsolve::Statistics::addDecision() { ++decisions; }
+
+void cdclsolve::Statistics::addConflict(std::size_t learnedClauseSize,
+                                        std::int32_t lbd,
+                                        std::int32_t backjumpDistance) {
+  ++learnedClauseSizes[getBucket(learnedClauseSize)];
+  ++lbds[getBucket(static_cast<std::uint64_t>(lbd))];
+  ++backjumpDistances[getBucket(static_cast<std::uint64_t>(backjumpDistance))];
+}
+
+cdclsolve::Statistics::ThreadClock::time_point
+cdclsolve::Statistics::ThreadClock::now() {
+  timespec time{};
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+  return time_point{std::chrono::duration_cast<duration>(
+      std::chrono::seconds{time.tv_sec} +
+      std::chrono::nanoseconds{time.tv_nsec})};
+}
+
+cdclsolve::Statistics::ThreadClock::time_point
+cdclsolve::Statistics::startSample(Phase phase) {
+  if (++calls[static_cast<std::size_t>(phase)] %
+          (phase == Phase::REDUCTION ? 1 : SAMPLE_INTERVAL) !=
+      0) {
+    return {};
+  }
+  return ThreadClock::now();
+}
+
+void cdclsolve::Statistics::stopSample(Phase phase,
+                                       ThreadClock::time_point start) {
+  if (start == ThreadClock::time_point{}) {
+    return;
+  }
+  ++samples[static_cast<std::size_t>(phase)];
+  sampledDurations[static_cast<std::size_t>(phase)] +=
+      ThreadClock::now() - start;
+}
+
+std::uint64_t cdclsolve::Statistics::getDecisions() const { return decisions; }
+
+const cdclsolve::Statistics::Histogram &
+cdclsolve::Statistics::getLearnedClauseSizes() const {
+  return learnedClauseSizes;
+}
+
+const cdclsolve::Statistics::Histogram &cdclsolve::Statistics::getLbds() const {
+  return lbds;
+}
+
+const cdclsolve::Statistics::Histogram &
+cdclsolve::Statistics::getBackjumpDistances() const {
+  return backjumpDistances;
+}
+
+std::chrono::steady_clock::duration
+cdclsolve::Statistics::getDuration(Phase phase) const {
+  const auto index{static_cast<std::size_t>(phase)};
+  if (samples[index] == 0) {
+    return std::chrono::steady_clock::duration::zero();
+  }
+  return std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+      std::chrono::duration<double, std::chrono::steady_clock::period>{
+          sampledDurations[index]} *
+      (static_cast<double>(calls[index]) / samples[index]));
+}
+
+std::uint64_t cdclsolve::Statistics::getBucketBound(std::size_t bucket) {
+  return bucket == 0 ? 0 : std::uint64_t{1} << (bucket - 1);
+}
+
+std::size_t cdclsolve::Statistics::getBucket(std::uint64_t value) {
+  std::size_t bucket{0};
+  while (value != 0 && bucket + 1 < HISTOGRAM_SIZE) {
+    value >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
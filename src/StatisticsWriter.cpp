@@ -0,0 +1,234 @@
+#include <cdclsolve/StatisticsWriter.hpp>
+
+#include <unistd.h>
+
+#include <fstream>
+#include <sstream>
+
+const std::map<std::string, cdclsolve::StatisticsWriter::Format>
+    cdclsolve::StatisticsWriter::formatMap{{"text", Format::TEXT},
+                                           {"json", Format::JSON}};
+
+cdclsolve::StatisticsWriter::StatisticsWriter(std::ostream &to,
+                                              const std::string &format)
+    : to{to}, format{formatMap.at(format)},
+      start{std::chrono::steady_clock::now()} {}
+
+const std::map<cdclsolve::Solver::Result, std::string>
+    cdclsolve::StatisticsWriter::resultMap{
+        {Solver::Result::SAT, "SAT"},
+        {Solver::Result::UNSAT, "UNSAT"},
+        {Solver::Result::UNKNOWN, "UNKNOWN"}};
+
+void cdclsolve::StatisticsWriter::write(const Solver &solver) {
+  write(solver, {}, nullptr);
+}
+
+void cdclsolve::StatisticsWriter::write(const Solver &solver,
+                                        const std::vector<Formula> &formulas) {
+  Counters threadCounters;
+  for (std::size_t i{0}; i < formulas.size(); ++i) {
+    const auto prefix{"thread_" + std::to_string(i) + "_"};
+    threadCounters.emplace_back(prefix + "exported",
+                                formulas[i].getExportedClauses());
+    threadCounters.emplace_back(prefix + "imported",
+                                formulas[i].getImportedClauses());
+    threadCounters.emplace_back(prefix + "useful",
+                                formulas[i].getUsefulClauses());
+  }
+  write(solver, threadCounters, nullptr);
+}
+
+void cdclsolve::StatisticsWriter::write(const Solver &solver,
+                                        const CubeAndConquer &cubeAndConquer) {
+  write(solver, {}, &cubeAndConquer);
+}
+
+void cdclsolve::StatisticsWriter::write(const Solver &solver,
+                                        const Counters &threadCounters,
+                                        const CubeAndConquer *cubeAndConquer) {
+  const auto &statistics{solver.getStatistics()};
+  const auto &formula{solver.getFormula()};
+  Counters counters{{"decisions", statistics.getDecisions()},
+                    {"propagations", formula.getPropagations()},
+                    {"conflicts", formula.getConflicts()},
+                    {"restarts", solver.getRestarts()},
+                    {"reductions", formula.getReductions()},
+                    {"eliminated", formula.getEliminatedVariables()},
+                    {"exported", formula.getExportedClauses()},
+                    {"imported", formula.getImportedClauses()},
+                    {"useful", formula.getUsefulClauses()}};
+  counters.insert(counters.end(), threadCounters.begin(),
+                  threadCounters.end());
+  const Histograms histograms{
+      {"learned_size", &statistics.getLearnedClauseSizes()},
+      {"lbd", &statistics.getLbds()},
+      {"backjump", &statistics.getBackjumpDistances()}};
+  const Durations durations{
+      {"propagation",
+       statistics.getDuration(Statistics::Phase::PROPAGATION)},
+      {"decision", statistics.getDuration(Statistics::Phase::DECISION)},
+      {"conflict_resolution",
+       statistics.getDuration(Statistics::Phase::CONFLICT_RESOLUTION)},
+      {"reduction", statistics.getDuration(Statistics::Phase::REDUCTION)},
+      {"cpu", solver.getDurationCpu()},
+      {"total", solver.getDurationTotal()}};
+  if (format == Format::JSON) {
+    writeJson(counters, histograms, durations, cubeAndConquer);
+  } else {
+    writeText(counters, histograms, durations, cubeAndConquer);
+  }
+  to.flush();
+}
+
+void cdclsolve::StatisticsWriter::writeProgress(std::size_t thread,
+                                                const Solver &solver) {
+  if (progress.size() <= thread) {
+    progress.resize(thread + 1, {start});
+  }
+  const auto &formula{solver.getFormula()};
+  const Progress current{std::chrono::steady_clock::now(),
+                         formula.getConflicts(), formula.getPropagations()};
+  const auto seconds{toSeconds(current.time - progress[thread].time)};
+  const Counters counters{
+      {"thread", thread},
+      {"conflicts", current.conflicts},
+      {"conflicts_per_second",
+       perSecond(current.conflicts - progress[thread].conflicts, seconds)},
+      {"propagations_per_second",
+       perSecond(current.propagations - progress[thread].propagations,
+                 seconds)},
+      {"trail", formula.getTrailSize()},
+      {"learned", formula.getNumberOfLearnedClauses()},
+      {"rss", getResidentMemory()},
+      {"restart_interval", solver.getRestartInterval()}};
+  progress[thread] = current;
+  std::ostringstream line;
+  if (format == Format::JSON) {
+    line << "{\"progress\":{\"time\":" << toSeconds(current.time - start);
+    for (const auto &[name, value] : counters) {
+      line << ",\"" << name << "\":" << value;
+    }
+    line << "}}\n";
+  } else {
+    line << "progress time " << toSeconds(current.time - start);
+    for (const auto &[name, value] : counters) {
+      line << ' ' << name << ' ' << value;
+    }
+    line << '\n';
+  }
+  to << line.str();
+  to.flush();
+}
+
+void cdclsolve::StatisticsWriter::writeText(
+    const Counters &counters, const Histograms &histograms,
+    const Durations &durations, const CubeAndConquer *cubeAndConquer) {
+  const auto cpu{durations[durations.size() - 2].second};
+  std::ostringstream text;
+  for (const auto &[name, value] : counters) {
+    text << name << ' ' << value << '\n';
+  }
+  for (const auto &[name, histogram] : histograms) {
+    text << name;
+    for (std::size_t i{0}; i < histogram->size(); ++i) {
+      if ((*histogram)[i] != 0) {
+        text << ' ' << Statistics::getBucketBound(i) << ':' << (*histogram)[i];
+      }
+    }
+    text << '\n';
+  }
+  for (std::size_t i{0}; i + 1 < durations.size(); ++i) {
+    text << "time_" << durations[i].first << ' '
+         << toSeconds(durations[i].second) << ' '
+         << (cpu == std::chrono::steady_clock::duration::zero()
+                 ? 0.0
+                 : toSeconds(durations[i].second) / toSeconds(cpu))
+         << '\n';
+  }
+  text << "time_" << durations.back().first << ' '
+       << toSeconds(durations.back().second) << '\n';
+  if (cubeAndConquer != nullptr) {
+    text << "time_lookahead "
+         << toSeconds(cubeAndConquer->getDurationLookahead()) << '\n'
+         << "cubes " << cubeAndConquer->getCubes().size() << '\n';
+    for (const auto &cube : cubeAndConquer->getCubes()) {
+      text << "cube";
+      for (const auto literal : cube.literals) {
+        text << ' ' << literal;
+      }
+      text << " result " << resultMap.at(cube.result) << " time "
+           << toSeconds(cube.duration) << " worker " << cube.worker << '\n';
+    }
+  }
+  to << text.str();
+}
+
+void cdclsolve::StatisticsWriter::writeJson(
+    const Counters &counters, const Histograms &histograms,
+    const Durations &durations, const CubeAndConquer *cubeAndConquer) {
+  std::ostringstream json;
+  json << '{';
+  for (const auto &[name, value] : counters) {
+    json << '"' << name << "\":" << value << ',';
+  }
+  for (const auto &[name, histogram] : histograms) {
+    json << '"' << name << "\":{";
+    bool isFirst{true};
+    for (std::size_t i{0}; i < histogram->size(); ++i) {
+      if ((*histogram)[i] != 0) {
+        json << (isFirst ? "" : ",") << '"' << Statistics::getBucketBound(i)
+             << "\":" << (*histogram)[i];
+        isFirst = false;
+      }
+    }
+    json << "},";
+  }
+  json << "\"time\":{";
+  for (std::size_t i{0}; i < durations.size(); ++i) {
+    json << (i == 0 ? "" : ",") << '"' << durations[i].first
+         << "\":" << toSeconds(durations[i].second);
+  }
+  if (cubeAndConquer != nullptr) {
+    json << ",\"lookahead\":"
+         << toSeconds(cubeAndConquer->getDurationLookahead());
+  }
+  json << '}';
+  if (cubeAndConquer != nullptr) {
+    json << ",\"cubes\":[";
+    const auto &cubes{cubeAndConquer->getCubes()};
+    for (std::size_t i{0}; i < cubes.size(); ++i) {
+      json << (i == 0 ? "" : ",") << "{\"literals\":[";
+      for (std::size_t j{0}; j < cubes[i].literals.size(); ++j) {
+        json << (j == 0 ? "" : ",") << cubes[i].literals[j];
+      }
+      json << "],\"result\":\"" << resultMap.at(cubes[i].result)
+           << "\",\"time\":" << toSeconds(cubes[i].duration)
+           << ",\"worker\":" << cubes[i].worker << '}';
+    }
+    json << ']';
+  }
+  json << "}\n";
+  to << json.str();
+}
+
+double cdclsolve::StatisticsWriter::toSeconds(
+    std::chrono::steady_clock::duration duration) {
+  return std::chrono::duration_cast<std::chrono::duration<double>>(duration)
+      .count();
+}
+
+std::uint64_t cdclsolve::StatisticsWriter::perSecond(std::uint64_t count,
+                                                     double seconds) {
+  return seconds > 0.0 ? static_cast<std::uint64_t>(count / seconds) : 0;
+}
+
+std::size_t cdclsolve::StatisticsWriter::getResidentMemory() {
+  std::ifstream statm{std::string{RESIDENT_MEMORY_FILE}};
+  std::size_t size{0};
+  std::size_t resident{0};
+  if (!(statm >> size >> resident)) {
+    return 0;
+  }
+  return resident * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
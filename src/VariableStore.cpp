@@ -0,0 +1,44 @@
+#include <cdclsolve/VariableStore.hpp>
+
+cdclsolve::VariableStore::VariableStore(std::int32_t numberOfVariables)
+    : values(2 * static_cast<std::size_t>(numberOfVariables) + 2, UNASSIGNED),
+      levels(static_cast<std::size_t>(numberOfVariables) + 1, -1),
+      reasons(static_cast<std::size_t>(numberOfVariables) + 1,
+              ClauseArena::NO_CLAUSE),
+      phases(static_cast<std::size_t>(numberOfVariables) + 1, FALSE) {}
+
+void cdclsolve::VariableStore::resize(std::int32_t numberOfVariables) {
+  values.resize(2 * static_cast<std::size_t>(numberOfVariables) + 2,
+                UNASSIGNED);
+  levels.resize(static_cast<std::size_t>(numberOfVariables) + 1, -1);
+  reasons.resize(static_cast<std::size_t>(numberOfVariables) + 1,
+                 ClauseArena::NO_CLAUSE);
+  phases.resize(static_cast<std::size_t>(numberOfVariables) + 1, FALSE);
+}
+
+std::int32_t cdclsolve::VariableStore::getNumberOfVariables() const {
+  return static_cast<std::int32_t>(levels.size()) - 1;
+}
+
+void cdclsolve::VariableStore::assign(std::int32_t literal,
+                                      ClauseReference reason,
+                                      std::int32_t decisionLevel) {
+  const auto variable{std::abs(literal)};
+  values[getLiteralIndex(literal)] = TRUE;
+  values[getLiteralIndex(-literal)] = FALSE;
+  levels[variable] = decisionLevel;
+  reasons[variable] = reason;
+}
+
+void cdclsolve::VariableStore::unassign(std::int32_t variable) {
+  phases[variable] = values[getLiteralIndex(variable)];
+  values[getLiteralIndex(variable)] = UNASSIGNED;
+  values[getLiteralIndex(-variable)] = UNASSIGNED;
+  levels[variable] = -1;
+  reasons[variable] = ClauseArena::NO_CLAUSE;
+}
+
+void cdclsolve::VariableStore::setValue(std::int32_t literal) {
+  values[getLiteralIndex(literal)] = TRUE;
+  values[getLiteralIndex(-literal)] = FALSE;
+}
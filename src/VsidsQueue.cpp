@@ -0,0 +1,54 @@
+#include <cdclsolve/VsidsQueue.hpp>
+
+cdclsolve::VsidsQueue::VsidsQueue(std::int32_t numberOfVariables)
+    : heap{static_cast<std::size_t>(numberOfVariables) + 1} {
+  for (std::int32_t v{1}; v <= numberOfVariables; ++v) {
+    heap.insert(v);
+  }
+}
+
+void cdclsolve::VsidsQueue::resize(std::int32_t numberOfVariables) {
+  const auto previous{heap.getSize()};
+  heap.resize(static_cast<std::size_t>(numberOfVariables) + 1);
+  for (auto v{previous}; v < heap.getSize(); ++v) {
+    heap.insert(v);
+  }
+}
+
+void cdclsolve::VsidsQueue::bump(std::int32_t variable) {
+  heap.setScore(variable, heap.getScore(variable) + increment);
+  if (heap.getScore(variable) > RESCALE_LIMIT) {
+    rescale();
+  }
+}
+
+void cdclsolve::VsidsQueue::decay() {
+  increment /= DECAY;
+  if (increment > RESCALE_LIMIT) {
+    rescale();
+  }
+}
+
+void cdclsolve::VsidsQueue::insert(std::int32_t variable) {
+  heap.insert(variable);
+}
+
+bool cdclsolve::VsidsQueue::isEmpty() const { return heap.isEmpty(); }
+
+std::int32_t cdclsolve::VsidsQueue::removeMax() {
+  return static_cast<std::int32_t>(heap.removeMax());
+}
+
+double cdclsolve::VsidsQueue::getActivity(std::int32_t variable) const {
+  return heap.getScore(variable);
+}
+
+void cdclsolve::VsidsQueue::setActivity(std::int32_t variable,
+                                        double activity) {
+  heap.setScore(variable, activity);
+}
+
+void cdclsolve::VsidsQueue::rescale() {
+  heap.scale(1.0 / RESCALE_LIMIT);
+  increment /= RESCALE_LIMIT;
+}
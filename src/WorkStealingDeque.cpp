@@ -0,0 +1,26 @@
+#include <cdclsolve/WorkStealingDeque.hpp>
+
+void cdclsolve::WorkStealingDeque::push(std::size_t item) {
+  std::lock_guard<std::mutex> lock{mutex};
+  items.push_back(item);
+}
+
+bool cdclsolve::WorkStealingDeque::pop(std::size_t &item) {
+  std::lock_guard<std::mutex> lock{mutex};
+  if (items.empty()) {
+    return false;
+  }
+  item = items.back();
+  items.pop_back();
+  return true;
+}
+
+bool cdclsolve::WorkStealingDeque::steal(std::size_t &item) {
+  std::lock_guard<std::mutex> lock{mutex};
+  if (items.empty()) {
+    return false;
+  }
+  item = items.front();
+  items.pop_front();
+  return true;
+}
@@ -0,0 +1,190 @@
+#include <cdclsolve/Formula.hpp>
+#include <cdclsolve/Generator.hpp>
+
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct Instance {
+  std::string name;
+  cdclsolve::Generator::Cnf cnf;
+};
+
+struct Result {
+  std::string benchmark;
+  std::string instance;
+  std::string heuristic;
+  std::uint64_t calls{0};
+  std::chrono::steady_clock::duration duration{
+      std::chrono::steady_clock::duration::zero()};
+};
+
+using decisionFunction = std::int32_t (cdclsolve::Formula::*)() const;
+
+static const std::map<std::string, decisionFunction> decisionHeuristicMap{
+    {"basic", &cdclsolve::Formula::decideBasic},
+    {"jeroslowwang", &cdclsolve::Formula::decideJeroslowWang},
+    {"dlis", &cdclsolve::Formula::decideDlis},
+    {"vsids", &cdclsolve::Formula::decideVsids}};
+
+static std::vector<Instance> generateInstances(std::uint32_t seed) {
+  cdclsolve::Generator generator{seed};
+  std::vector<Instance> instances;
+  for (const std::int32_t n : {100, 200, 300}) {
+    instances.push_back({"ksat3-" + std::to_string(n),
+                         generator.randomKSat(3, n, 4.26)});
+  }
+  for (const std::int32_t n : {7, 8, 9}) {
+    instances.push_back({"pigeonhole-" + std::to_string(n),
+                         cdclsolve::Generator::pigeonhole(n)});
+  }
+  for (const std::int32_t n : {16, 32, 48}) {
+    instances.push_back({"parity-" + std::to_string(n), generator.parity(n)});
+  }
+  for (const std::int32_t n : {60, 120, 240}) {
+    instances.push_back({"coloring3-" + std::to_string(n),
+                         generator.graphColoring(n, 4.6, 3)});
+  }
+  return instances;
+}
+
+static Result benchmarkParse(const Instance &instance,
+                             std::size_t repetitions) {
+  std::ostringstream dimacs;
+  cdclsolve::Generator::writeDimacs(instance.cnf, dimacs);
+  const auto text{dimacs.str()};
+  Result result{"parse", instance.name, "", repetitions};
+  for (std::size_t i{0}; i < repetitions; ++i) {
+    std::istringstream from{text};
+    const auto start{std::chrono::steady_clock::now()};
+    const auto formula{cdclsolve::Formula::readInput(from)};
+    result.duration += std::chrono::steady_clock::now() - start;
+  }
+  return result;
+}
+
+static std::vector<Result> benchmarkSearch(const Instance &instance,
+                                           const std::string &heuristic,
+                                           std::uint64_t conflicts) {
+  auto formula{cdclsolve::Generator::toFormula(instance.cnf)};
+  const auto decide{decisionHeuristicMap.at(heuristic)};
+  Result propagate{"propagate", instance.name, heuristic};
+  Result analyze{"analyze", instance.name, heuristic};
+  Result decision{"decide", instance.name, heuristic};
+  const auto measure{[](Result &result, const auto &function) {
+    const auto start{std::chrono::steady_clock::now()};
+    function();
+    result.duration += std::chrono::steady_clock::now() - start;
+    ++result.calls;
+  }};
+  std::int32_t decisionLevel{0};
+  measure(propagate,
+          [&] { formula.propagateUnitLiterals(decisionLevel); });
+  while (!formula.hasConflict() && formula.hasFreeLiterals() &&
+         formula.getConflicts() < conflicts) {
+    measure(decision, [&] {
+      const auto literal{(formula.*decide)()};
+      ++decisionLevel;
+      formula.assign(literal, decisionLevel);
+    });
+    measure(propagate,
+            [&] { formula.propagateUnitLiterals(decisionLevel); });
+    while (formula.hasConflict() && decisionLevel >= 0) {
+      measure(analyze,
+              [&] { decisionLevel = formula.resolveConflict(decisionLevel); });
+      if (decisionLevel >= 0) {
+        measure(propagate,
+                [&] { formula.propagateUnitLiterals(decisionLevel); });
+      }
+    }
+  }
+  return {propagate, analyze, decision};
+}
+
+static void writeResult(const Result &result, const Instance &instance,
+                        std::ostream &to) {
+  const auto seconds{
+      std::chrono::duration_cast<std::chrono::duration<double>>(
+          result.duration)
+          .count()};
+  to << "{\"benchmark\":\"" << result.benchmark << "\",\"instance\":\""
+     << result.instance << "\",\"variables\":"
+     << instance.cnf.numberOfVariables
+     << ",\"clauses\":" << instance.cnf.clauses.size();
+  if (!result.heuristic.empty()) {
+    to << ",\"heuristic\":\"" << result.heuristic << '"';
+  }
+  to << ",\"calls\":" << result.calls << ",\"seconds\":" << seconds
+     << ",\"ns_per_call\":"
+     << (result.calls == 0 ? 0.0 : seconds * 1e9 / result.calls) << '}';
+}
+
+int main(int argc, char **argv) {
+  boost::program_options::options_description desc("Allowed options");
+  desc.add_options()("help,h", "produce help message")(
+      "output,o", boost::program_options::value<std::string>(),
+      "file name of JSON results")(
+      "seed,s",
+      boost::program_options::value<std::uint32_t>()->default_value(1),
+      "seed of the instance generators")(
+      "conflicts,c",
+      boost::program_options::value<std::uint64_t>()->default_value(5000),
+      "maximum number of conflicts per search benchmark")(
+      "repetitions,r",
+      boost::program_options::value<std::size_t>()->default_value(5),
+      "number of repetitions of the parse benchmark")(
+      "filter,f", boost::program_options::value<std::string>(),
+      "only run instances whose name contains this text");
+  boost::program_options::variables_map vm;
+  boost::program_options::store(
+      boost::program_options::parse_command_line(argc, argv, desc), vm);
+  boost::program_options::notify(vm);
+  if (vm.count("help")) {
+    std::cout << desc << std::endl;
+    return 0;
+  }
+
+  const auto seed{vm["seed"].as<std::uint32_t>()};
+  const auto conflicts{vm["conflicts"].as<std::uint64_t>()};
+  std::ofstream output;
+  if (vm.count("output")) {
+    output.open(vm["output"].as<std::string>());
+  }
+  auto &to{output.is_open() ? output : std::cout};
+  to << "{\"seed\":" << seed << ",\"conflicts\":" << conflicts
+     << ",\"results\":[";
+  bool isFirst{true};
+  for (const auto &instance : generateInstances(seed)) {
+    if (vm.count("filter") &&
+        instance.name.find(vm["filter"].as<std::string>()) ==
+            std::string::npos) {
+      continue;
+    }
+    std::vector<Result> results{
+        benchmarkParse(instance, vm["repetitions"].as<std::size_t>())};
+    for (const auto &[heuristic, decide] : decisionHeuristicMap) {
+      for (const auto &result :
+           benchmarkSearch(instance, heuristic, conflicts)) {
+        results.push_back(result);
+      }
+    }
+    for (const auto &result : results) {
+      to << (isFirst ? "\n" : ",\n");
+      writeResult(result, instance, to);
+      isFirst = false;
+    }
+    to.flush();
+  }
+  to << "\n]}" << std::endl;
+  return 0;
+}
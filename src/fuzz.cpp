@@ -0,0 +1,396 @@
+#include <cdclsolve/Formula.hpp>
+#include <cdclsolve/Generator.hpp>
+#include <cdclsolve/ProofWriter.hpp>
+#include <cdclsolve/SignalWatcher.hpp>
+#include <cdclsolve/Solver.hpp>
+
+#include <boost/program_options/options_description.hpp>
+#include <boost/program_options/parsers.hpp>
+#include <boost/program_options/variables_map.hpp>
+
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+static int constexpr returnPassed{0};
+static int constexpr returnInterrupted{1};
+static int constexpr returnFailed{2};
+static std::int32_t constexpr oracleVariables{20};
+static const std::vector<std::string> decisionHeuristics{
+    "basic", "jeroslowwang", "dlis", "vsids"};
+static const std::vector<std::string> restartStrategies{"none", "luby",
+                                                        "geometric", "glucose"};
+static const std::map<std::int32_t, double> clauseRatioMap{
+    {2, 1.0}, {3, 4.26}, {4, 9.93}};
+
+using Cnf = cdclsolve::Generator::Cnf;
+using Clauses = std::vector<std::vector<std::int32_t>>;
+
+struct Configuration {
+  std::string decisionHeuristic;
+  std::string restartStrategy;
+  std::uint64_t conflicts{0};
+  std::filesystem::path proofFile;
+  bool isPreprocessing{false};
+  std::filesystem::path binaryFile;
+};
+
+struct Outcome {
+  cdclsolve::Solver::Result result{cdclsolve::Solver::Result::UNKNOWN};
+  std::string error;
+};
+
+static Cnf generate(std::uint32_t seed, std::int32_t maxVariables) {
+  std::mt19937 generator{seed};
+  const auto numberOfVariables{static_cast<std::int32_t>(
+      3 + generator() % static_cast<std::uint32_t>(maxVariables - 2))};
+  const auto k{static_cast<std::int32_t>(
+      2 + generator() % static_cast<std::uint32_t>(clauseRatioMap.size()))};
+  const auto ratio{clauseRatioMap.at(std::min(k, numberOfVariables)) *
+                   (0.5 + static_cast<double>(generator() % 1000) / 1000.0)};
+  return cdclsolve::Generator{static_cast<std::uint32_t>(generator())}
+      .randomKSat(std::min(k, numberOfVariables), numberOfVariables, ratio);
+}
+
+static bool isSatisfied(const std::vector<std::int32_t> &clause,
+                        const std::vector<std::int8_t> &values) {
+  return std::any_of(clause.begin(), clause.end(), [&values](auto literal) {
+    return values[std::abs(literal)] == (literal > 0 ? 1 : -1);
+  });
+}
+
+static bool propagate(const Clauses &clauses,
+                      std::vector<std::int8_t> &values) {
+  for (bool isChanged{true}; isChanged;) {
+    isChanged = false;
+    for (const auto &clause : clauses) {
+      if (isSatisfied(clause, values)) {
+        continue;
+      }
+      std::int32_t unit{0};
+      std::size_t numberOfFree{0};
+      for (const auto literal : clause) {
+        if (values[std::abs(literal)] == 0) {
+          unit = literal;
+          ++numberOfFree;
+        }
+      }
+      if (numberOfFree == 0) {
+        return false;
+      }
+      if (numberOfFree == 1) {
+        values[std::abs(unit)] = unit > 0 ? 1 : -1;
+        isChanged = true;
+      }
+    }
+  }
+  return true;
+}
+
+static bool isSatisfiable(const Clauses &clauses,
+                          std::vector<std::int8_t> values) {
+  if (!propagate(clauses, values)) {
+    return false;
+  }
+  const auto free{std::find(values.begin() + 1, values.end(), 0)};
+  if (free == values.end()) {
+    return true;
+  }
+  for (const std::int8_t value : {1, -1}) {
+    *free = value;
+    if (isSatisfiable(clauses, values)) {
+      return true;
+    }
+    *free = 0;
+  }
+  return false;
+}
+
+static bool isImplied(const Clauses &clauses, std::int32_t numberOfVariables,
+                      const std::vector<std::int32_t> &lemma) {
+  std::vector<std::int8_t> values(numberOfVariables + 1, 0);
+  for (const auto literal : lemma) {
+    if (values[std::abs(literal)] == (literal > 0 ? -1 : 1)) {
+      continue;
+    }
+    if (values[std::abs(literal)] != 0) {
+      return true;
+    }
+    values[std::abs(literal)] = literal > 0 ? -1 : 1;
+  }
+  return !propagate(clauses, values);
+}
+
+static std::string checkProof(const Cnf &cnf,
+                              const std::filesystem::path &proofFile) {
+  auto clauses{cnf.clauses};
+  for (auto &clause : clauses) {
+    std::sort(clause.begin(), clause.end());
+  }
+  std::ifstream proof{proofFile};
+  std::size_t lineNumber{0};
+  for (std::string line; std::getline(proof, line);) {
+    ++lineNumber;
+    std::istringstream tokens{line};
+    const auto isDeletion{line.rfind("d ", 0) == 0};
+    if (isDeletion) {
+      tokens.ignore(2);
+    }
+    std::vector<std::int32_t> clause;
+    for (std::int32_t literal; tokens >> literal && literal != 0;) {
+      clause.push_back(literal);
+    }
+    std::sort(clause.begin(), clause.end());
+    if (isDeletion) {
+      const auto deleted{std::find(clauses.begin(), clauses.end(), clause)};
+      if (clause.size() > 1 && deleted != clauses.end()) {
+        *deleted = std::move(clauses.back());
+        clauses.pop_back();
+      }
+      continue;
+    }
+    if (!isImplied(clauses, cnf.numberOfVariables, clause)) {
+      return "proof line " + std::to_string(lineNumber) + " is not RUP";
+    }
+    clauses.push_back(std::move(clause));
+  }
+  if (!isImplied(clauses, cnf.numberOfVariables, {})) {
+    return "proof does not derive the empty clause";
+  }
+  return {};
+}
+
+static Outcome solve(const Cnf &cnf, const Configuration &configuration) {
+  Outcome outcome;
+  try {
+    auto formula{cdclsolve::Generator::toFormula(cnf)};
+    const auto isProofChecked{cnf.numberOfVariables > oracleVariables};
+    std::unique_ptr<cdclsolve::ProofWriter> proofWriter;
+    if (isProofChecked) {
+      proofWriter = std::make_unique<cdclsolve::ProofWriter>(
+          configuration.proofFile.string(), "drat");
+      formula.setProofWriter(*proofWriter);
+    }
+    if (configuration.isPreprocessing) {
+      formula.preprocess();
+    }
+    {
+      std::ofstream binary{configuration.binaryFile, std::ios::binary};
+      cdclsolve::Formula::writeBinary(formula, binary);
+    }
+    auto copy{cdclsolve::Formula::readInput(configuration.binaryFile.string())};
+    cdclsolve::Solver solver{formula, configuration.decisionHeuristic,
+                             configuration.restartStrategy};
+    solver.setBudget({configuration.conflicts});
+    outcome.result = solver.solve();
+    proofWriter.reset();
+    cdclsolve::Solver copySolver{copy, configuration.decisionHeuristic,
+                                 configuration.restartStrategy};
+    copySolver.setBudget({configuration.conflicts});
+    const auto copyResult{copySolver.solve()};
+    if (outcome.result != cdclsolve::Solver::Result::UNKNOWN &&
+        copyResult != cdclsolve::Solver::Result::UNKNOWN &&
+        copyResult != outcome.result) {
+      outcome.error = "binary copy of the formula has a different result";
+      return outcome;
+    }
+    if (outcome.result == cdclsolve::Solver::Result::SAT) {
+      for (const auto &clause : cnf.clauses) {
+        if (std::none_of(clause.begin(), clause.end(), [&](auto literal) {
+              return formula.getVariables().isTrue(literal);
+            })) {
+          outcome.error = "model falsifies a clause";
+          break;
+        }
+      }
+    } else if (outcome.result == cdclsolve::Solver::Result::UNSAT) {
+      if (!isProofChecked) {
+        if (isSatisfiable(cnf.clauses,
+                          std::vector<std::int8_t>(cnf.numberOfVariables + 1,
+                                                   0))) {
+          outcome.error = "unsatisfiable, but the oracle found a model";
+        }
+      } else {
+        outcome.error = checkProof(cnf, configuration.proofFile);
+      }
+    }
+  } catch (const std::exception &exception) {
+    outcome.error = std::string{"exception: "} + exception.what();
+  }
+  return outcome;
+}
+
+static Cnf shrink(Cnf cnf, const Configuration &configuration) {
+  const auto isFailing{[&configuration](const Cnf &candidate) {
+    return !solve(candidate, configuration).error.empty();
+  }};
+  for (std::size_t parts{2}; cnf.clauses.size() >= 2;) {
+    const auto chunk{(cnf.clauses.size() + parts - 1) / parts};
+    bool isReduced{false};
+    for (std::size_t begin{0}; begin < cnf.clauses.size(); begin += chunk) {
+      auto candidate{cnf};
+      candidate.clauses.erase(
+          candidate.clauses.begin() + begin,
+          candidate.clauses.begin() +
+              std::min(begin + chunk, candidate.clauses.size()));
+      if (isFailing(candidate)) {
+        cnf = std::move(candidate);
+        parts = std::max<std::size_t>(parts - 1, 2);
+        isReduced = true;
+        break;
+      }
+    }
+    if (!isReduced) {
+      if (parts >= cnf.clauses.size()) {
+        break;
+      }
+      parts = std::min(parts * 2, cnf.clauses.size());
+    }
+  }
+  for (std::size_t c{0}; c < cnf.clauses.size(); ++c) {
+    for (std::size_t l{0}; cnf.clauses[c].size() > 1 &&
+                           l < cnf.clauses[c].size();) {
+      auto candidate{cnf};
+      candidate.clauses[c].erase(candidate.clauses[c].begin() + l);
+      if (isFailing(candidate)) {
+        cnf = std::move(candidate);
+      } else {
+        ++l;
+      }
+    }
+  }
+  return cnf;
+}
+
+static void writeCnf(const Cnf &cnf, const std::filesystem::path &fileName) {
+  std::ofstream to{fileName};
+  cdclsolve::Generator::writeDimacs(cnf, to);
+}
+
+int main(int argc, char **argv) {
+  boost::program_options::options_description desc("Allowed options");
+  desc.add_options()("help,h", "produce help message")(
+      "output,o",
+      boost::program_options::value<std::string>()->default_value("fuzz"),
+      "directory to write failing formulas to")(
+      "count,c",
+      boost::program_options::value<std::uint64_t>()->default_value(0),
+      "number of formulas, 0 to run until a failure or a signal")(
+      "seed,s",
+      boost::program_options::value<std::uint32_t>()->default_value(
+          std::random_device{}()),
+      "seed of the first formula")(
+      "jobs,j",
+      boost::program_options::value<std::size_t>()->default_value(
+          std::max(std::thread::hardware_concurrency(), 1u)),
+      "number of formulas checked concurrently")(
+      "max-variables",
+      boost::program_options::value<std::int32_t>()->default_value(40),
+      "maximum number of variables per formula")(
+      "conflicts",
+      boost::program_options::value<std::uint64_t>()->default_value(100000),
+      "maximum number of conflicts per solve");
+  boost::program_options::variables_map vm;
+  boost::program_options::store(
+      boost::program_options::parse_command_line(argc, argv, desc), vm);
+  boost::program_options::notify(vm);
+  if (vm.count("help")) {
+    std::cout << desc << std::endl;
+    return 0;
+  }
+
+  cdclsolve::SignalWatcher signalWatcher{
+      std::chrono::steady_clock::duration::zero()};
+  const std::filesystem::path outputDirectory{vm["output"].as<std::string>()};
+  const auto count{vm["count"].as<std::uint64_t>()};
+  const auto seed{vm["seed"].as<std::uint32_t>()};
+  const auto maxVariables{std::max(vm["max-variables"].as<std::int32_t>(), 3)};
+  const auto conflicts{vm["conflicts"].as<std::uint64_t>()};
+  std::atomic<std::uint64_t> next{0};
+  std::atomic<std::uint64_t> checked{0};
+  std::atomic<bool> isInterrupted{false};
+  std::atomic<bool> isFailed{false};
+  std::mutex outputMutex;
+  signalWatcher.setHandler([&isInterrupted] { isInterrupted.store(true); });
+  std::cout << "seed " << seed << std::endl;
+
+  std::vector<std::thread> threads;
+  for (std::size_t j{0}; j < vm["jobs"].as<std::size_t>(); ++j) {
+    threads.emplace_back([&, j] {
+      const auto proofFile{std::filesystem::temp_directory_path() /
+                           ("cdclsolve_fuzz_" + std::to_string(getpid()) +
+                            "_" + std::to_string(j) + ".drat")};
+      auto binaryFile{proofFile};
+      binaryFile.replace_extension(".bin");
+      for (auto i{next++}; (count == 0 || i < count) &&
+                           !isInterrupted.load() && !isFailed.load();
+           i = next++) {
+        const auto formulaSeed{static_cast<std::uint32_t>(seed + i)};
+        const auto cnf{generate(formulaSeed, maxVariables)};
+        std::vector<std::pair<Configuration, Outcome>> outcomes;
+        for (std::size_t h{0}; h < decisionHeuristics.size(); ++h) {
+          const Configuration configuration{
+              decisionHeuristics[h],
+              restartStrategies[(formulaSeed + h) % restartStrategies.size()],
+              conflicts, proofFile, (formulaSeed + h) % 2 == 0, binaryFile};
+          outcomes.emplace_back(configuration, solve(cnf, configuration));
+        }
+        for (const auto &[configuration, outcome] : outcomes) {
+          auto error{outcome.error};
+          if (error.empty() &&
+              outcome.result != cdclsolve::Solver::Result::UNKNOWN &&
+              std::any_of(outcomes.begin(), outcomes.end(), [&](auto &o) {
+                return o.second.result !=
+                           cdclsolve::Solver::Result::UNKNOWN &&
+                       o.second.result != outcome.result;
+              })) {
+            error = "results of the decision heuristics differ";
+          }
+          if (error.empty()) {
+            continue;
+          }
+          isFailed.store(true);
+          const auto name{std::to_string(formulaSeed) + "-" +
+                          configuration.decisionHeuristic + "-" +
+                          configuration.restartStrategy +
+                          (configuration.isPreprocessing ? "-preprocess"
+                                                         : "")};
+          std::filesystem::create_directories(outputDirectory);
+          writeCnf(cnf, outputDirectory / (name + ".cnf"));
+          writeCnf(shrink(cnf, configuration),
+                   outputDirectory / (name + "-shrunk.cnf"));
+          std::lock_guard<std::mutex> lock{outputMutex};
+          std::cout << "fail " << name << ": " << error << std::endl;
+        }
+        ++checked;
+      }
+      std::filesystem::remove(proofFile);
+      std::filesystem::remove(binaryFile);
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  signalWatcher.setHandler(nullptr);
+  std::cout << "checked " << checked.load() << std::endl;
+  return isFailed.load()        ? returnFailed
+         : isInterrupted.load() ? returnInterrupted
+                                : returnPassed;
+}
@@ -1,18 +1,34 @@
+#include <cdclsolve/Batch.hpp>
+#include <cdclsolve/CubeAndConquer.hpp>
 #include <cdclsolve/Formula.hpp>
+#include <cdclsolve/Portfolio.hpp>
+#include <cdclsolve/ProofWriter.hpp>
+#include <cdclsolve/SignalWatcher.hpp>
+#include <cdclsolve/SolutionWriter.hpp>
 #include <cdclsolve/Solver.hpp>
+#include <cdclsolve/StatisticsWriter.hpp>
 
 #include <boost/program_options/option.hpp>
 #include <boost/program_options/options_description.hpp>
 #include <boost/program_options/parsers.hpp>
 #include <boost/program_options/variables_map.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <fstream>
 #include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
 #include <string>
+#include <thread>
 
 static int constexpr returnSatisfiable{10};
 static int constexpr returnUnsatisfiable{20};
+static int constexpr returnUnknown{0};
+static std::size_t constexpr megabyte{1 << 20};
 
 int main(int argc, char **argv) {
   boost::program_options::options_description desc("Allowed options");
@@ -21,9 +37,73 @@ int main(int argc, char **argv) {
       "file name of input formula")(
       "output,o", boost::program_options::value<std::string>(),
       "file name of output solution")(
+      "format,f",
+      boost::program_options::value<std::string>()->default_value("qdimacs"),
+      "format of output solution")(
+      "proof,p", boost::program_options::value<std::string>(),
+      "file name of proof to write")(
+      "proof-format",
+      boost::program_options::value<std::string>()->default_value("drat"),
+      "format of proof to write")(
+      "write-binary,b", boost::program_options::value<std::string>(),
+      "file name of binary formula to write instead of solving")(
       "decision,d", boost::program_options::value<std::string>(),
-      "decision heuristic to use")("measure,m",
-                                   "measure and print solving times");
+      "decision heuristic to use")(
+      "restart,r",
+      boost::program_options::value<std::string>()->default_value("none"),
+      "restart strategy to use")(
+      "no-preprocess",
+      "skip subsumption and variable elimination before solving")(
+      "threads,t",
+      boost::program_options::value<std::size_t>()->default_value(1),
+      "number of solver threads")(
+      "portfolio", "race diversified solvers on all threads")(
+      "share-size",
+      boost::program_options::value<std::size_t>()->default_value(8),
+      "maximum size of clauses shared between threads, 0 disables sharing")(
+      "share-lbd",
+      boost::program_options::value<std::int32_t>()->default_value(6),
+      "maximum LBD of clauses shared between threads")(
+      "cube", "split the formula into cubes solved on all threads")(
+      "cube-depth",
+      boost::program_options::value<std::size_t>()->default_value(8),
+      "maximum number of literals per cube")(
+      "batch", boost::program_options::value<std::string>(),
+      "list file or directory of formulas to solve in one run")(
+      "jobs,j",
+      boost::program_options::value<std::size_t>()->default_value(
+          std::max(std::thread::hardware_concurrency(), 1u)),
+      "number of formulas solved concurrently in batch mode")(
+      "timeout",
+      boost::program_options::value<double>()->default_value(0.0),
+      "time limit per formula in seconds in batch mode, 0 for none")(
+      "batch-format",
+      boost::program_options::value<std::string>()->default_value("jsonl"),
+      "format of batch records")(
+      "batch-output", boost::program_options::value<std::string>(),
+      "directory to write one solution per formula in batch mode")(
+      "conflicts",
+      boost::program_options::value<std::uint64_t>()->default_value(0),
+      "maximum number of conflicts, 0 for no limit")(
+      "propagations",
+      boost::program_options::value<std::uint64_t>()->default_value(0),
+      "maximum number of propagated literals, 0 for no limit")(
+      "time-limit",
+      boost::program_options::value<double>()->default_value(0.0),
+      "maximum solving time in seconds, 0 for no limit")(
+      "memory-limit",
+      boost::program_options::value<std::size_t>()->default_value(0),
+      "maximum peak resident memory of the whole process in megabytes, "
+      "shared by all solver threads, 0 for no limit")(
+      "progress",
+      boost::program_options::value<double>()->default_value(0.0),
+      "seconds between progress lines, 0 for none")(
+      "progress-conflicts",
+      boost::program_options::value<std::uint64_t>()->default_value(0),
+      "conflicts between progress lines, 0 for none")(
+      "stats,m",
+      boost::program_options::value<std::string>()->implicit_value("text"),
+      "print solver statistics in the given format");
   boost::program_options::variables_map vm;
   boost::program_options::store(
       boost::program_options::parse_command_line(argc, argv, desc), vm);
@@ -33,17 +113,158 @@ int main(int argc, char **argv) {
     return 0;
   }
 
-  std::ifstream input;
-  if (vm.count("input")) {
-    input.open(vm["input"].as<std::string>());
-    if (input.is_open()) {
-      std::cin.rdbuf(input.rdbuf());
+  cdclsolve::SignalWatcher signalWatcher{
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>{vm["progress"].as<double>()})};
+  cdclsolve::Solver::Budget budget{
+      vm["conflicts"].as<std::uint64_t>(),
+      vm["propagations"].as<std::uint64_t>(),
+      std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+          std::chrono::duration<double>{vm["time-limit"].as<double>()}),
+      vm["memory-limit"].as<std::size_t>() * megabyte};
+  if (vm.count("batch")) {
+    if (vm["timeout"].as<double>() > 0.0) {
+      budget.time =
+          std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+              std::chrono::duration<double>{vm["timeout"].as<double>()});
     }
+    cdclsolve::Batch batch{vm["batch"].as<std::string>(),
+                           vm["jobs"].as<std::size_t>(), budget,
+                           vm["decision"].as<std::string>(),
+                           vm["restart"].as<std::string>(),
+                           !vm.count("no-preprocess")};
+    signalWatcher.setHandler([&batch] { batch.interrupt(); });
+    std::ofstream output;
+    if (vm.count("output")) {
+      output.open(vm["output"].as<std::string>());
+    }
+    batch.solve(output.is_open() ? output : std::cout,
+                vm["batch-format"].as<std::string>(),
+                vm.count("batch-output")
+                    ? vm["batch-output"].as<std::string>()
+                    : std::string{},
+                vm["format"].as<std::string>());
+    signalWatcher.setHandler(nullptr);
+    return 0;
+  }
+
+  cdclsolve::Formula formula{
+      vm.count("input")
+          ? cdclsolve::Formula::readInput(vm["input"].as<std::string>())
+          : cdclsolve::Formula::readInput(std::cin)};
+  if (vm.count("write-binary")) {
+    std::ofstream binary{vm["write-binary"].as<std::string>(),
+                         std::ios::binary};
+    cdclsolve::Formula::writeBinary(formula, binary);
+    return binary ? 0 : 1;
+  }
+  std::unique_ptr<cdclsolve::ProofWriter> proofWriter;
+  if (vm.count("proof") && vm.count("portfolio")) {
+    throw std::runtime_error("proofs are not supported in portfolio mode");
+  }
+  if (vm.count("proof") && vm.count("cube")) {
+    throw std::runtime_error("proofs are not supported in cube mode");
+  }
+  if (vm.count("portfolio") && vm.count("cube")) {
+    throw std::runtime_error("portfolio and cube mode are exclusive");
+  }
+  if (vm.count("proof")) {
+    proofWriter = std::make_unique<cdclsolve::ProofWriter>(
+        vm["proof"].as<std::string>(), vm["proof-format"].as<std::string>());
+    formula.setProofWriter(*proofWriter);
+  }
+  if (!vm.count("no-preprocess")) {
+    formula.preprocess();
   }
-  cdclsolve::Formula formula{cdclsolve::Formula::readInput(std::cin)};
   const std::string decisionHeuristic{vm["decision"].as<std::string>()};
-  cdclsolve::Solver solver{cdclsolve::Solver(formula, decisionHeuristic)};
-  auto s{solver.solve()};
+  const std::string restartStrategy{vm["restart"].as<std::string>()};
+  cdclsolve::SolutionWriter writer{std::cout, vm["format"].as<std::string>()};
+  std::unique_ptr<cdclsolve::Portfolio> portfolio;
+  std::unique_ptr<cdclsolve::CubeAndConquer> cubeAndConquer;
+  std::unique_ptr<cdclsolve::Solver> singleSolver;
+  if (vm.count("portfolio")) {
+    portfolio = std::make_unique<cdclsolve::Portfolio>(
+        std::move(formula), vm["threads"].as<std::size_t>(),
+        decisionHeuristic, restartStrategy, vm["share-size"].as<std::size_t>(),
+        vm["share-lbd"].as<std::int32_t>());
+  } else if (vm.count("cube")) {
+    cubeAndConquer = std::make_unique<cdclsolve::CubeAndConquer>(
+        std::move(formula), vm["threads"].as<std::size_t>(),
+        vm["cube-depth"].as<std::size_t>(), decisionHeuristic,
+        restartStrategy);
+  } else {
+    singleSolver = std::make_unique<cdclsolve::Solver>(
+        formula, decisionHeuristic, restartStrategy);
+  }
+  if (vm.count("stats")) {
+    if (portfolio) {
+      portfolio->enableStatistics();
+    } else if (cubeAndConquer) {
+      cubeAndConquer->enableStatistics();
+    } else {
+      singleSolver->enableStatistics();
+    }
+  }
+  cdclsolve::StatisticsWriter statisticsWriter{
+      std::cerr,
+      vm.count("stats") ? vm["stats"].as<std::string>() : std::string{"text"}};
+  std::mutex reportMutex;
+  const auto reporter{[&statisticsWriter, &reportMutex](
+                          std::size_t thread, const cdclsolve::Solver &solver,
+                          cdclsolve::Solver::Report report) {
+    std::lock_guard<std::mutex> lock{reportMutex};
+    if (report == cdclsolve::Solver::Report::PROGRESS) {
+      statisticsWriter.writeProgress(thread, solver);
+    } else {
+      statisticsWriter.write(solver);
+    }
+  }};
+  const auto progressConflicts{vm["progress-conflicts"].as<std::uint64_t>()};
+  if (portfolio) {
+    portfolio->setBudget(budget);
+    portfolio->setReporter(reporter, progressConflicts);
+    signalWatcher.setHandler([&portfolio] { portfolio->interrupt(); });
+  } else if (cubeAndConquer) {
+    cubeAndConquer->setBudget(budget);
+    cubeAndConquer->setReporter(reporter, progressConflicts);
+    signalWatcher.setHandler(
+        [&cubeAndConquer] { cubeAndConquer->interrupt(); });
+  } else {
+    singleSolver->setBudget(budget);
+    singleSolver->setReporter(
+        [&reporter](const cdclsolve::Solver &solver,
+                    cdclsolve::Solver::Report report) {
+          reporter(0, solver, report);
+        },
+        progressConflicts);
+    signalWatcher.setHandler([&singleSolver] { singleSolver->interrupt(); });
+  }
+  const auto requestReport{
+      [&portfolio, &cubeAndConquer,
+       &singleSolver](cdclsolve::Solver::Report report) {
+        if (portfolio) {
+          portfolio->requestReport(report);
+        } else if (cubeAndConquer) {
+          cubeAndConquer->requestReport(report);
+        } else {
+          singleSolver->requestReport(report);
+        }
+      }};
+  signalWatcher.setDumpHandler([&requestReport] {
+    requestReport(cdclsolve::Solver::Report::STATISTICS);
+  });
+  signalWatcher.setTimerHandler([&requestReport] {
+    requestReport(cdclsolve::Solver::Report::PROGRESS);
+  });
+  auto s{portfolio         ? portfolio->solve()
+         : cubeAndConquer ? cubeAndConquer->solve()
+                          : singleSolver->solve()};
+  signalWatcher.setHandler(nullptr);
+  signalWatcher.setDumpHandler(nullptr);
+  signalWatcher.setTimerHandler(nullptr);
+  const auto &solver{portfolio         ? portfolio->getSolver()
+                     : cubeAndConquer ? cubeAndConquer->getSolver()
+                                      : *singleSolver};
 
   std::ofstream output;
   if (vm.count("output")) {
@@ -52,33 +273,21 @@ int main(int argc, char **argv) {
       std::cout.rdbuf(output.rdbuf());
     }
   }
-  cdclsolve::Formula::writeOutput(formula, std::cout);
+  writer.write(portfolio         ? portfolio->getFormula()
+               : cubeAndConquer ? cubeAndConquer->getFormula()
+                                : formula,
+               s);
 
-  if (vm.count("measure")) {
-    std::chrono::steady_clock::duration duration;
-    duration = solver.getDurationBooleanConstraintPropagation();
-    std::cerr << std::chrono::duration_cast<std::chrono::duration<double>>(
-                     duration)
-                     .count()
-              << " " << solver.getRelativeDurationBooleanConstraintPropagation()
-              << std::endl;
-    duration = solver.getDurationConflictResolution();
-    std::cerr << std::chrono::duration_cast<std::chrono::duration<double>>(
-                     duration)
-                     .count()
-              << " " << solver.getRelativeDurationConflictResolution()
-              << std::endl;
-    duration = solver.getDurationDecision();
-    std::cerr << std::chrono::duration_cast<std::chrono::duration<double>>(
-                     duration)
-                     .count()
-              << " " << solver.getRelativeDurationDecision() << std::endl;
-    duration = solver.getDurationTotal();
-    std::cerr << std::chrono::duration_cast<std::chrono::duration<double>>(
-                     duration)
-                     .count()
-              << " " << solver.getRelativeDurationTotal() << std::endl;
+  if (vm.count("stats")) {
+    if (portfolio) {
+      statisticsWriter.write(solver, portfolio->getFormulas());
+    } else if (cubeAndConquer) {
+      statisticsWriter.write(solver, *cubeAndConquer);
+    } else {
+      statisticsWriter.write(solver);
+    }
   }
-  return s == cdclsolve::Solver::Result::SAT ? returnSatisfiable
-                                             : returnUnsatisfiable;
+  return s == cdclsolve::Solver::Result::SAT     ? returnSatisfiable
+         : s == cdclsolve::Solver::Result::UNSAT ? returnUnsatisfiable
+                                                 : returnUnknown;
 }